@@ -0,0 +1,62 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Checks for the batch seeders in jsf.c: raninit*_n() on n seeds must
+   leave every context as n calls of raninit*() would, from the same
+   random() sequence, including a partial last block. Prints each
+   mismatch and returns nonzero on any.
+
+     cc -O2 check_jsf.c -o check_jsf && ./check_jsf
+ */
+
+#define main jsf_main
+#include "jsf.c"
+#undef main
+
+#include <string.h>
+
+#define CHECK_N (3 * RANINIT_BLOCK + 5)
+
+#define CHECK_RANINIT_N(bits, ctx, type) \
+static int check_raninit##bits(void) { \
+	ctx batch[CHECK_N], single[CHECK_N]; \
+	type seed[CHECK_N]; \
+	int failed = 0; \
+	for (size_t j=0; j<CHECK_N; ++j) { seed[j] = (type)(0x9e3779b97f4a7c15ull * (j + 1)); } \
+	for (size_t n=0; n<=CHECK_N; ++n) { \
+		srandom(42); \
+		raninit##bits##_n(batch, seed, n); \
+		srandom(42); \
+		for (size_t j=0; j<n; ++j) { raninit##bits(&single[j], seed[j]); } \
+		for (size_t j=0; j<n; ++j) { \
+			if (memcmp(&batch[j], &single[j], sizeof(ctx)) != 0) { \
+				printf("raninit%d_n mismatch: n %zu, context %zu\n", bits, n, j); \
+				failed = 1; \
+			} \
+		} \
+	} \
+	return failed; \
+}
+CHECK_RANINIT_N(8, ranctx8_t, u1)
+CHECK_RANINIT_N(16, ranctx16_t, u2)
+CHECK_RANINIT_N(32, ranctx32_t, u4)
+CHECK_RANINIT_N(64, ranctx64_t, u8)
+
+int main(void) {
+	int const failed = check_raninit8() | check_raninit16() | check_raninit32() | check_raninit64();
+	if (!failed) { printf("All raninit_n checks passed.\n"); }
+	return failed;
+}
@@ -0,0 +1,151 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Checks for the jumps in prng.h and prng_jump.h, for every xoshiro and
+   xoroshiro state: *_jump_by(k) must match k calls of *_step() for
+   small k and add up for large ones, the characteristic polynomials
+   must give the published jump and long jump constants, *_jump() and
+   *_long_jump() must match *_jump_by(), and the jump table must match
+   *_jump(). Prints each mismatch and returns nonzero on any.
+
+     cc -O2 check_jump.c -o check_jump && ./check_jump
+ */
+
+#include <stdio.h>
+
+#include "prng_jump.h"
+
+// Steps checked one by one against *_jump_by()
+#define CHECK_STEPS 300
+// Streams checked from the jump table
+#define CHECK_STREAMS 5
+
+// Published constants, from the reference code at https://prng.di.unimi.it/
+static uint64_t const CHECK_JUMP_xoshiro128[] = { 0xf542d2d38764000b, 0x77f2db5b6fa035c3 };
+static uint64_t const CHECK_LONG_JUMP_xoshiro128[] = { 0x0b6f099fb523952e, 0x1c580662ccf5a0ef };
+static uint64_t const CHECK_JUMP_xoshiro256[] = {
+	0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c };
+static uint64_t const CHECK_LONG_JUMP_xoshiro256[] = {
+	0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635 };
+static uint64_t const CHECK_JUMP_xoroshiro128[] = { 0xdf900294d8f554a5, 0x170865df4b3201fc };
+static uint64_t const CHECK_LONG_JUMP_xoroshiro128[] = { 0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1 };
+static uint64_t const CHECK_JUMP_xoroshiro128pp[] = { 0x2bd7a6a6e99c2ddc, 0x0992ccaf6a6fca05 };
+static uint64_t const CHECK_LONG_JUMP_xoroshiro128pp[] = { 0x360fd5f2cf8d5d99, 0x9c6e6877736c46e3 };
+
+static prng_jumptable_t table;
+
+// d = 2^k as a jump distance
+static void check_power(uint64_t d[PRNG_JUMP_WORDS], int k) {
+	memset(d, 0, PRNG_JUMP_WORDS * sizeof(d[0]));
+	d[k / 64] = (uint64_t)1 << (k % 64);
+}
+
+// The jump polynomial for 2^k against a published constant; xoroshiro64
+// has none, so only the jumps below check its polynomial
+static int check_constant(char const *name, char const *jump, uint64_t const *published, uint64_t const P[], int bits, int k) {
+	uint64_t d[PRNG_JUMP_WORDS], poly[PRNG_JUMP_WORDS];
+	if (!published) { return 0; }
+	check_power(d, k);
+	prng_jump_polynomial(poly, d, P, bits);
+	if (memcmp(poly, published, bits / 8) != 0) {
+		printf("%s %s polynomial differs from the published constant\n", name, jump);
+		return 1;
+	}
+	return 0;
+}
+
+#define CHECK_JUMP(name, ctx, bits, init, published, long_published) \
+static int check_##name(void) { \
+	ctx const seed = init; \
+	ctx x, y; \
+	uint64_t d[PRNG_JUMP_WORDS] = { 0 }, e[PRNG_JUMP_WORDS] = { 0 }, sum[PRNG_JUMP_WORDS] = { 0 }; \
+	uint64_t poly[PRNG_JUMP_WORDS]; \
+	ctx streams[CHECK_STREAMS]; \
+	int failed = 0; \
+	failed |= check_constant(#name, "jump", published, PRNG_CHARPOLY_##name, (bits), (bits) / 2); \
+	failed |= check_constant(#name, "long jump", long_published, PRNG_CHARPOLY_##name, (bits), (bits) / 4 * 3); \
+	/* Small distances against single steps */ \
+	y = seed; \
+	for (uint64_t k = 0; k <= CHECK_STEPS; ++k) { \
+		x = seed; \
+		d[0] = k; \
+		name##_jump_by(&x, d); \
+		if (memcmp(&x, &y, sizeof(ctx)) != 0) { \
+			printf(#name "_jump_by(%llu) differs from single steps\n", (unsigned long long)k); \
+			failed = 1; \
+		} \
+		name##_step(&y); \
+	} \
+	/* Large distances must add up, d + e kept below 2^bits */ \
+	for (int w = 0; w < (bits) / 64; ++w) { \
+		d[w] = 0x9e3779b97f4a7c15 * (uint64_t)(w + 1) >> 1; \
+		e[w] = 0xbf58476d1ce4e5b9 * (uint64_t)(w + 1) >> 1; \
+	} \
+	for (int w = 0, carry = 0; w < (bits) / 64; ++w) { \
+		sum[w] = d[w] + e[w] + (uint64_t)carry; \
+		carry = sum[w] < d[w] || (carry && sum[w] == d[w]); \
+	} \
+	x = y = seed; \
+	name##_jump_by(&x, d); \
+	name##_jump_by(&x, e); \
+	name##_jump_by(&y, sum); \
+	if (memcmp(&x, &y, sizeof(ctx)) != 0) { \
+		printf(#name "_jump_by(d) then (e) differs from (d + e)\n"); \
+		failed = 1; \
+	} \
+	/* The fixed jumps */ \
+	x = y = seed; \
+	name##_jump(&x); \
+	check_power(d, (bits) / 2); \
+	name##_jump_by(&y, d); \
+	if (memcmp(&x, &y, sizeof(ctx)) != 0) { \
+		printf(#name "_jump differs from _jump_by(2^%d)\n", (bits) / 2); \
+		failed = 1; \
+	} \
+	x = y = seed; \
+	name##_long_jump(&x); \
+	check_power(e, (bits) / 4 * 3); \
+	name##_jump_by(&y, e); \
+	if (memcmp(&x, &y, sizeof(ctx)) != 0) { \
+		printf(#name "_long_jump differs from _jump_by(2^%d)\n", (bits) / 4 * 3); \
+		failed = 1; \
+	} \
+	/* The jump table against _jump(), one stream at a time */ \
+	prng_jump_polynomial(poly, d, PRNG_CHARPOLY_##name, (bits)); \
+	name##_jumptable_init(&table, poly); \
+	name##_streams(&seed, streams, CHECK_STREAMS, &table); \
+	x = seed; \
+	for (int i = 0; i < CHECK_STREAMS; ++i) { \
+		if (memcmp(&streams[i], &x, sizeof(ctx)) != 0) { \
+			printf(#name "_streams differs from _jump at stream %d\n", i); \
+			failed = 1; \
+		} \
+		name##_jump(&x); \
+	} \
+	return failed; \
+}
+CHECK_JUMP(xoshiro128, xoshiro128_t, 128, PRNG_INIT_xoshiro128pp, CHECK_JUMP_xoshiro128, CHECK_LONG_JUMP_xoshiro128)
+CHECK_JUMP(xoroshiro64, xoroshiro64_t, 64, PRNG_INIT_xoroshiro64ss, NULL, NULL)
+CHECK_JUMP(xoshiro256, xoshiro256_t, 256, PRNG_INIT_xoshiro256pp, CHECK_JUMP_xoshiro256, CHECK_LONG_JUMP_xoshiro256)
+CHECK_JUMP(xoroshiro128, xoroshiro128_t, 128, PRNG_INIT_xoroshiro128ss, CHECK_JUMP_xoroshiro128, CHECK_LONG_JUMP_xoroshiro128)
+CHECK_JUMP(xoroshiro128pp, xoroshiro128_t, 128, PRNG_INIT_xoroshiro128pp, CHECK_JUMP_xoroshiro128pp, CHECK_LONG_JUMP_xoroshiro128pp)
+
+int main(void) {
+	int const failed = check_xoshiro128() | check_xoroshiro64() | check_xoshiro256()
+		| check_xoroshiro128() | check_xoroshiro128pp();
+	if (!failed) { printf("All jump checks passed.\n"); }
+	return failed;
+}
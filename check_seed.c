@@ -0,0 +1,129 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Checks for prng_seed.h: the scalar words must follow a plain
+   SplitMix64 loop, and the AVX2 and AVX-512 kernels must write the same
+   words as the scalar one for any start and length without touching the
+   bytes around them. Seeding a long run of jsfsmall and jsftiny
+   contexts must never leave one in the all-zero state, which both
+   generators keep forever; the runs are long enough to include raw
+   words that start all zero. Prints each failure and returns nonzero
+   on any.
+
+     cc -O2 check_seed.c -o check_seed && ./check_seed
+ */
+
+#include <stdio.h>
+
+#include "prng_seed.h"
+
+#define CHECK_SEED 0x5eed
+
+#define CHECK_WORDS 67
+
+// SplitMix64 as published, stepping the state by the golden gamma
+static uint64_t check_splitmix64(uint64_t *state) {
+	uint64_t z = (*state += 0x9e3779b97f4a7c15);
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+	return z ^ (z >> 31);
+}
+
+static int check_scalar(void) {
+	uint64_t const seeds[] = { 0, 1, 1234567, CHECK_SEED, ~0ull };
+	uint64_t words[CHECK_WORDS];
+	int failed = 0;
+	// First output of the published code for seed 1234567
+	prng_seed_words_scalar(1234567, 0, words, 1);
+	if (words[0] != 6457827717110365317ull) {
+		printf("scalar word 0 for seed 1234567 is %llu\n", (unsigned long long)words[0]);
+		failed = 1;
+	}
+	for (size_t s = 0; s < sizeof(seeds) / sizeof(seeds[0]); ++s) {
+		uint64_t state = seeds[s];
+		prng_seed_words_scalar(seeds[s], 0, words, CHECK_WORDS);
+		for (size_t k = 0; k < CHECK_WORDS; ++k) {
+			if (words[k] != check_splitmix64(&state)) {
+				printf("scalar mismatch: seed %llu, word %zu\n", (unsigned long long)seeds[s], k);
+				failed = 1;
+			}
+		}
+	}
+	return failed;
+}
+
+typedef void check_words_fn(uint64_t, uint64_t, void *, size_t);
+
+// Words first to first + n - 1 written one byte past a guard, compared
+// with the scalar kernel
+static int check_kernel(char const *kernel, check_words_fn *words) {
+	uint64_t const firsts[] = { 0, 1, 3, 1000, ~0ull - 40 };
+	unsigned char want[8 * CHECK_WORDS + 2], got[8 * CHECK_WORDS + 2];
+	int failed = 0;
+	for (size_t f = 0; f < sizeof(firsts) / sizeof(firsts[0]); ++f) {
+		for (size_t n = 0; n <= CHECK_WORDS; ++n) {
+			memset(want, 0xa5, sizeof(want));
+			memset(got, 0xa5, sizeof(got));
+			prng_seed_words_scalar(CHECK_SEED, firsts[f], want + 1, n);
+			words(CHECK_SEED, firsts[f], got + 1, n);
+			if (memcmp(want, got, sizeof(want)) != 0) {
+				printf("%s mismatch: first %llu, n %zu\n", kernel, (unsigned long long)firsts[f], n);
+				failed = 1;
+			}
+		}
+	}
+	return failed;
+}
+
+#define CHECK_NONZERO(name, ctx, bytes, total) \
+static int check_nonzero_##name(void) { \
+	static ctx x[1 << 16]; \
+	size_t const block = sizeof(x) / sizeof(x[0]); \
+	size_t raw = 0; \
+	int failed = 0; \
+	for (uint64_t first = 0; first < (total); first += block) { \
+		name##_seed_n(x, block, CHECK_SEED, first); \
+		for (size_t j = 0; j < block; ++j) { \
+			uint64_t const w = prng_seed_word(CHECK_SEED, first + j); \
+			raw += (w & ((1ull << 8 * (bytes)) - 1)) == 0; \
+			ctx const zero = { 0 }; \
+			if (memcmp(&x[j], &zero, sizeof(ctx)) == 0) { \
+				printf(#name " context %llu seeded all zero\n", (unsigned long long)(first + j)); \
+				failed = 1; \
+			} \
+		} \
+	} \
+	if (raw == 0) { \
+		printf(#name ": no all-zero raw word in %llu contexts\n", (unsigned long long)(total)); \
+		failed = 1; \
+	} \
+	return failed; \
+}
+CHECK_NONZERO(jsftiny, jsftiny_t, 2, 1ull << 20)
+CHECK_NONZERO(jsfsmall, jsfsmall_t, 3, 1ull << 25)
+
+int main(void) {
+	int failed = check_scalar() | check_kernel("prng_seed_words", prng_seed_words);
+#if PRNG_SIMD_X86
+	if (PRNG_HAS_AVX2()) { failed |= check_kernel("avx2", prng_seed_words_avx2); }
+	else { printf("No AVX2, its kernel is not checked.\n"); }
+	if (PRNG_HAS_AVX512DQ()) { failed |= check_kernel("avx512", prng_seed_words_avx512); }
+	else { printf("No AVX-512DQ, its kernel is not checked.\n"); }
+#endif
+	failed |= check_nonzero_jsftiny() | check_nonzero_jsfsmall();
+	if (!failed) { printf("All seeding checks passed.\n"); }
+	return failed;
+}
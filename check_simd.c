@@ -0,0 +1,319 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Checks for prng_simd.h: every lane kernel the CPU can run, and the
+   fill functions that dispatch to them, must give each lane exactly the
+   values its scalar generator from prng.h would, across several calls
+   of varying length, and leave each lane's state where the scalar one
+   ends up. Prints each mismatch and returns nonzero on any.
+
+     cc -O2 check_simd.c -o check_simd && ./check_simd
+ */
+
+#include <stdio.h>
+
+#include "prng_simd.h"
+
+// Rows per call, run back to back so each call starts where the
+// previous one left the state
+static size_t const check_rows[] = { 0, 1, 2, 3, 4, 5, 7, 8, 9, 16, 31, 64 };
+#define CHECK_CALLS (sizeof(check_rows) / sizeof(check_rows[0]))
+#define CHECK_MAX_ROWS 64
+// Longest fill, in values, for the fill functions
+#define CHECK_MAX_FILL 77
+
+// Name the instruction sets whose kernels this CPU cannot run
+static void check_report_unsupported(void) {
+#if PRNG_SIMD_X86
+	if (!PRNG_HAS_AVX2()) { printf("No AVX2, its kernels are not checked.\n"); }
+	if (!PRNG_HAS_AVX512()) { printf("No AVX-512F, its xoshiro256 kernel is not checked.\n"); }
+	if (!PRNG_HAS_AVX512DQ()) { printf("No AVX-512DQ, its pcg32 kernel is not checked.\n"); }
+	if (!PRNG_HAS_AVX512VL()) { printf("No AVX-512VL, its jsf kernels are not checked.\n"); }
+#else
+	printf("Not x86, only the scalar kernels are checked.\n");
+#endif
+}
+
+
+// xoshiro256, lanes seeded by xoshiro256xn_seed() from one state
+typedef void check_xoshiro256_kernel(uint64_t *s, size_t lanes, uint64_t *out, size_t rows);
+typedef uint64_t check_xoshiro256_next(xoshiro256_t *x);
+
+static void check_xoshiro256_lanes(xoshiro256_t ref[8], size_t lanes) {
+	ref[0] = (xoshiro256_t)PRNG_INIT_xoshiro256pp;
+	for (size_t l = 1; l < lanes; ++l) { ref[l] = ref[l - 1]; xoshiro256_jump(&ref[l]); }
+}
+
+static int check_xoshiro256(char const *kernel, size_t lanes, check_xoshiro256_kernel *run, check_xoshiro256_next *next) {
+	xoshiro256_t const seed = PRNG_INIT_xoshiro256pp;
+	xoshiro256_t ref[8];
+	uint64_t s[4 * 8], out[CHECK_MAX_ROWS * 8];
+	int failed = 0;
+	xoshiro256xn_seed(s, lanes, &seed);
+	check_xoshiro256_lanes(ref, lanes);
+	for (size_t c = 0; c < CHECK_CALLS; ++c) {
+		run(s, lanes, out, check_rows[c]);
+		for (size_t r = 0; r < check_rows[c]; ++r) {
+			for (size_t l = 0; l < lanes; ++l) {
+				if (out[r * lanes + l] != next(&ref[l])) {
+					printf("%s x%zu mismatch: call %zu, row %zu, lane %zu\n", kernel, lanes, c, r, l);
+					failed = 1;
+				}
+			}
+		}
+	}
+	for (size_t l = 0; l < lanes; ++l) {
+		for (int w = 0; w < 4; ++w) {
+			if (s[w * lanes + l] != ref[l].s[w]) {
+				printf("%s x%zu state mismatch: lane %zu, word %d\n", kernel, lanes, l, w);
+				failed = 1;
+			}
+		}
+	}
+	return failed;
+}
+
+#define CHECK_XOSHIRO256_FILL(variant, lanes) \
+static int check_xoshiro256##variant##x##lanes##_fill(void) { \
+	xoshiro256_t const seed = PRNG_INIT_xoshiro256pp; \
+	xoshiro256x##lanes##_t rng; \
+	xoshiro256_t ref[8]; \
+	uint64_t out[CHECK_MAX_FILL], row[lanes]; \
+	int failed = 0; \
+	xoshiro256x##lanes##_seed(&rng, &seed); \
+	check_xoshiro256_lanes(ref, lanes); \
+	for (size_t n = 0; n <= CHECK_MAX_FILL; ++n) { \
+		xoshiro256##variant##x##lanes##_fill(&rng, out, n); \
+		for (size_t i = 0; i < n; i += lanes) { \
+			for (size_t l = 0; l < lanes; ++l) { row[l] = xoshiro256##variant##_next(&ref[l]); } \
+			for (size_t l = 0; l < lanes && i + l < n; ++l) { \
+				if (out[i + l] != row[l]) { \
+					printf("xoshiro256" #variant "x" #lanes "_fill mismatch: n %zu, value %zu\n", n, i + l); \
+					failed = 1; \
+				} \
+			} \
+		} \
+	} \
+	return failed; \
+}
+CHECK_XOSHIRO256_FILL(pp, 4)
+CHECK_XOSHIRO256_FILL(ss, 4)
+CHECK_XOSHIRO256_FILL(pp, 8)
+CHECK_XOSHIRO256_FILL(ss, 8)
+
+#if PRNG_SIMD_X86
+static void xoshiro256ppxn_avx512_lanes(uint64_t *s, size_t lanes, uint64_t *out, size_t rows) {
+	(void)lanes;
+	xoshiro256ppxn_avx512(s, out, rows);
+}
+static void xoshiro256ssxn_avx512_lanes(uint64_t *s, size_t lanes, uint64_t *out, size_t rows) {
+	(void)lanes;
+	xoshiro256ssxn_avx512(s, out, rows);
+}
+#endif
+
+static int check_xoshiro256xn(void) {
+	int failed = 0;
+	for (size_t lanes = 4; lanes <= 8; lanes += 4) {
+		failed |= check_xoshiro256("xoshiro256ppxn_scalar", lanes, xoshiro256ppxn_scalar, xoshiro256pp_next);
+		failed |= check_xoshiro256("xoshiro256ssxn_scalar", lanes, xoshiro256ssxn_scalar, xoshiro256ss_next);
+#if PRNG_SIMD_X86
+		if (PRNG_HAS_AVX2()) {
+			failed |= check_xoshiro256("xoshiro256ppxn_avx2", lanes, xoshiro256ppxn_avx2, xoshiro256pp_next);
+			failed |= check_xoshiro256("xoshiro256ssxn_avx2", lanes, xoshiro256ssxn_avx2, xoshiro256ss_next);
+		}
+#endif
+	}
+#if PRNG_SIMD_X86
+	if (PRNG_HAS_AVX512()) {
+		failed |= check_xoshiro256("xoshiro256ppxn_avx512", 8, xoshiro256ppxn_avx512_lanes, xoshiro256pp_next);
+		failed |= check_xoshiro256("xoshiro256ssxn_avx512", 8, xoshiro256ssxn_avx512_lanes, xoshiro256ss_next);
+	}
+#endif
+	return failed | check_xoshiro256ppx4_fill() | check_xoshiro256ssx4_fill()
+		| check_xoshiro256ppx8_fill() | check_xoshiro256ssx8_fill();
+}
+
+
+// pcg32 with 8 lanes, each lane seeded as pcg32_srandom_r() would with
+// its own sequence and checked against pcg32_next()
+typedef void check_pcg32x8_kernel(pcg32x8_t *rng, uint32_t *out, size_t rows);
+
+#define CHECK_PCG32_STATE 0x853c49e6748fea9bull
+
+static void check_pcg32_lanes(pcg32x8_t *rng, pcg32_t ref[8]) {
+	uint64_t seq[8];
+	for (int l = 0; l < 8; ++l) {
+		seq[l] = 0xda3e39cb94b95bdbull * (uint64_t)(l + 1);
+		ref[l] = (pcg32_t){ 0, (seq[l] << 1) | 1 };
+		(void)pcg32_next(&ref[l]);
+		ref[l].state += CHECK_PCG32_STATE;
+		(void)pcg32_next(&ref[l]);
+	}
+	pcg32x8_seed(rng, CHECK_PCG32_STATE, seq);
+}
+
+static int check_pcg32x8(char const *kernel, check_pcg32x8_kernel *run) {
+	pcg32x8_t rng;
+	pcg32_t ref[8], lanes[8];
+	uint32_t out[CHECK_MAX_ROWS * 8];
+	int failed = 0;
+	check_pcg32_lanes(&rng, ref);
+	for (size_t c = 0; c < CHECK_CALLS; ++c) {
+		run(&rng, out, check_rows[c]);
+		for (size_t r = 0; r < check_rows[c]; ++r) {
+			for (int l = 0; l < 8; ++l) {
+				if (out[r * 8 + l] != pcg32_next(&ref[l])) {
+					printf("%s mismatch: call %zu, row %zu, lane %d\n", kernel, c, r, l);
+					failed = 1;
+				}
+			}
+		}
+	}
+	pcg32x8_store(&rng, lanes);
+	for (int l = 0; l < 8; ++l) {
+		if (lanes[l].state != ref[l].state || lanes[l].inc != ref[l].inc) {
+			printf("%s state mismatch: lane %d\n", kernel, l);
+			failed = 1;
+		}
+	}
+	return failed;
+}
+
+static int check_pcg32x8_fill(void) {
+	pcg32x8_t rng;
+	pcg32_t ref[8];
+	uint32_t out[CHECK_MAX_FILL], row[8];
+	int failed = 0;
+	check_pcg32_lanes(&rng, ref);
+	for (size_t n = 0; n <= CHECK_MAX_FILL; ++n) {
+		pcg32x8_fill(&rng, out, n);
+		for (size_t i = 0; i < n; i += 8) {
+			for (int l = 0; l < 8; ++l) { row[l] = pcg32_next(&ref[l]); }
+			for (size_t l = 0; l < 8 && i + l < n; ++l) {
+				if (out[i + l] != row[l]) {
+					printf("pcg32x8_fill mismatch: n %zu, value %zu\n", n, i + l);
+					failed = 1;
+				}
+			}
+		}
+	}
+	return failed;
+}
+
+static int check_pcg32x8n(void) {
+	int failed = check_pcg32x8("pcg32x8_scalar", pcg32x8_scalar);
+#if PRNG_SIMD_X86
+	if (PRNG_HAS_AVX2()) { failed |= check_pcg32x8("pcg32x8_avx2", pcg32x8_avx2); }
+	if (PRNG_HAS_AVX512DQ()) { failed |= check_pcg32x8("pcg32x8_avx512", pcg32x8_avx512); }
+#endif
+	return failed | check_pcg32x8_fill();
+}
+
+
+// jsf with 8 x 32-bit and 4 x 64-bit lanes, each lane a context set up
+// as raninit() would and checked against jsf32_next() or jsf64_next()
+#define CHECK_JSFXN(bits, lanes) \
+typedef void check_jsf##bits##x##lanes##_kernel(jsf##bits##x##lanes##_t *rng, uint##bits##_t *out, size_t rows); \
+static void check_jsf##bits##_lanes(jsf##bits##x##lanes##_t *rng, jsf##bits##_t ref[lanes]) { \
+	for (int l = 0; l < lanes; ++l) { \
+		uint##bits##_t const seed = (uint##bits##_t)(0x9e3779b97f4a7c15ull * (uint64_t)(l + 1)); \
+		ref[l] = (jsf##bits##_t){ 0xf1ea5eed, seed, seed, seed }; \
+		for (int i = 0; i < RANINIT_ROUNDS; ++i) { (void)jsf##bits##_next(&ref[l]); } \
+	} \
+	jsf##bits##x##lanes##_load(rng, ref); \
+} \
+static int check_jsf##bits##x##lanes(char const *kernel, check_jsf##bits##x##lanes##_kernel *run) { \
+	jsf##bits##x##lanes##_t rng; \
+	jsf##bits##_t ref[lanes], ctx[lanes]; \
+	uint##bits##_t out[CHECK_MAX_ROWS * lanes]; \
+	int failed = 0; \
+	check_jsf##bits##_lanes(&rng, ref); \
+	for (size_t c = 0; c < CHECK_CALLS; ++c) { \
+		run(&rng, out, check_rows[c]); \
+		for (size_t r = 0; r < check_rows[c]; ++r) { \
+			for (int l = 0; l < lanes; ++l) { \
+				if (out[r * lanes + l] != jsf##bits##_next(&ref[l])) { \
+					printf("%s mismatch: call %zu, row %zu, lane %d\n", kernel, c, r, l); \
+					failed = 1; \
+				} \
+			} \
+		} \
+	} \
+	jsf##bits##x##lanes##_store(&rng, ctx); \
+	if (memcmp(ctx, ref, sizeof(ref)) != 0) { \
+		printf("%s state mismatch\n", kernel); \
+		failed = 1; \
+	} \
+	return failed; \
+} \
+static int check_jsf##bits##x##lanes##_fill(void) { \
+	jsf##bits##x##lanes##_t rng; \
+	jsf##bits##_t ref[lanes]; \
+	uint##bits##_t out[CHECK_MAX_FILL], row[lanes]; \
+	int failed = 0; \
+	check_jsf##bits##_lanes(&rng, ref); \
+	for (size_t n = 0; n <= CHECK_MAX_FILL; ++n) { \
+		jsf##bits##x##lanes##_fill(&rng, out, n); \
+		for (size_t i = 0; i < n; i += lanes) { \
+			for (int l = 0; l < lanes; ++l) { row[l] = jsf##bits##_next(&ref[l]); } \
+			for (size_t l = 0; l < lanes && i + l < n; ++l) { \
+				if (out[i + l] != row[l]) { \
+					printf("jsf" #bits "x" #lanes "_fill mismatch: n %zu, value %zu\n", n, i + l); \
+					failed = 1; \
+				} \
+			} \
+		} \
+	} \
+	/* Lane-major, each lane's rows in the order of single calls */ \
+	for (size_t rows = 0; rows <= 2 * CHECK_MAX_ROWS + 3; rows += 13) { \
+		uint##bits##_t lane[(2 * CHECK_MAX_ROWS + 3) * lanes]; \
+		jsf##bits##x##lanes##_fill_lanes(&rng, lane, rows); \
+		for (int l = 0; l < lanes; ++l) { \
+			for (size_t r = 0; r < rows; ++r) { \
+				if (lane[l * rows + r] != jsf##bits##_next(&ref[l])) { \
+					printf("jsf" #bits "x" #lanes "_fill_lanes mismatch: rows %zu, lane %d, row %zu\n", rows, l, r); \
+					failed = 1; \
+				} \
+			} \
+		} \
+	} \
+	return failed; \
+}
+CHECK_JSFXN(32, 8)
+CHECK_JSFXN(64, 4)
+
+static int check_jsfxn(void) {
+	int failed = check_jsf32x8("jsf32x8_scalar", jsf32x8_scalar) | check_jsf64x4("jsf64x4_scalar", jsf64x4_scalar);
+#if PRNG_SIMD_X86
+	if (PRNG_HAS_AVX2()) {
+		failed |= check_jsf32x8("jsf32x8_avx2", jsf32x8_avx2);
+		failed |= check_jsf64x4("jsf64x4_avx2", jsf64x4_avx2);
+	}
+	if (PRNG_HAS_AVX512VL()) {
+		failed |= check_jsf32x8("jsf32x8_avx512", jsf32x8_avx512);
+		failed |= check_jsf64x4("jsf64x4_avx512", jsf64x4_avx512);
+	}
+#endif
+	return failed | check_jsf32x8_fill() | check_jsf64x4_fill();
+}
+
+int main(void) {
+	check_report_unsupported();
+	int const failed = check_xoshiro256xn() | check_pcg32x8n() | check_jsfxn();
+	if (!failed) { printf("All lane kernel checks passed.\n"); }
+	return failed;
+}
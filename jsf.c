@@ -19,6 +19,7 @@
  */
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <time.h>
@@ -37,6 +38,13 @@ typedef struct { u8 a; u8 b; u8 c; u8 d; } ranctx64_t;
 #define rot32(x,k) (((x)<<(k))|((x)>>(32-(k))))
 #define rot64(x,k) (((x)<<(k))|((x)>>(64-(k))))
 
+// Fixed warm-up after seeding, as recommended by Jenkins, so seeding
+// takes the same time whatever the seed
+#define RANINIT_ROUNDS 20
+// Contexts warmed up together by the batch seeders, enough to overlap
+// their dependency chains while staying in registers and L1
+#define RANINIT_BLOCK 8
+
 u1 ranval8(ranctx8_t* x) {
 	u1 e = x->a - rot8(x->b, 1);
 	x->a = x->b ^ rot8(x->c, 4);
@@ -44,11 +52,32 @@ u1 ranval8(ranctx8_t* x) {
 	x->c = x->d + e;
 	return x->d = e + x->a;
 }
+// Write n values into buf, with the context held in locals
+void ranfill8(ranctx8_t *x, void *buf, size_t n) {
+	ranctx8_t r = *x;
+	u1 *out = buf;
+	for (size_t i=0; i<n; ++i) { out[i] = ranval8(&r); }
+	*x = r;
+}
 void raninit8(ranctx8_t *x, u1 seed) {
 	x->a = seed*random();
 	x->b = x->c = x->d = seed;
 
-	for (u1 i=seed; i>0; --i) { (void)ranval8(x); }
+	for (int i=0; i<RANINIT_ROUNDS; ++i) { (void)ranval8(x); }
+}
+// Seed n contexts from n seeds, identical to raninit8() on each in
+// turn, with the warm-up rounds of a block of contexts interleaved
+void raninit8_n(ranctx8_t *x, u1 const *seed, size_t n) {
+	for (size_t j=0; j<n; ++j) {
+		x[j].a = seed[j]*random();
+		x[j].b = x[j].c = x[j].d = seed[j];
+	}
+	for (size_t j=0; j<n; j+=RANINIT_BLOCK) {
+		size_t const m = n-j < RANINIT_BLOCK ? n-j : RANINIT_BLOCK;
+		for (int i=0; i<RANINIT_ROUNDS; ++i) {
+			for (size_t k=0; k<m; ++k) { (void)ranval8(&x[j+k]); }
+		}
+	}
 }
 
 u2 ranval16(ranctx16_t *x) {
@@ -58,11 +87,29 @@ u2 ranval16(ranctx16_t *x) {
 	x->c = x->d + e;
 	return x->d = e + x->a;
 }
+void ranfill16(ranctx16_t *x, void *buf, size_t n) {
+	ranctx16_t r = *x;
+	u2 *out = buf;
+	for (size_t i=0; i<n; ++i) { out[i] = ranval16(&r); }
+	*x = r;
+}
 void raninit16(ranctx16_t *x, u2 seed) {
 	x->a = seed*random();
 	x->b = x->c = x->d = seed;
 
-	for (u2 i=seed; i>0; --i) { (void)ranval16(x); }
+	for (int i=0; i<RANINIT_ROUNDS; ++i) { (void)ranval16(x); }
+}
+void raninit16_n(ranctx16_t *x, u2 const *seed, size_t n) {
+	for (size_t j=0; j<n; ++j) {
+		x[j].a = seed[j]*random();
+		x[j].b = x[j].c = x[j].d = seed[j];
+	}
+	for (size_t j=0; j<n; j+=RANINIT_BLOCK) {
+		size_t const m = n-j < RANINIT_BLOCK ? n-j : RANINIT_BLOCK;
+		for (int i=0; i<RANINIT_ROUNDS; ++i) {
+			for (size_t k=0; k<m; ++k) { (void)ranval16(&x[j+k]); }
+		}
+	}
 }
 
 u4 ranval32(ranctx32_t *x) {
@@ -72,11 +119,29 @@ u4 ranval32(ranctx32_t *x) {
 	x->c = x->d + e;
 	return x->d = e + x->a;
 }
+void ranfill32(ranctx32_t *x, void *buf, size_t n) {
+	ranctx32_t r = *x;
+	u4 *out = buf;
+	for (size_t i=0; i<n; ++i) { out[i] = ranval32(&r); }
+	*x = r;
+}
 void raninit32(ranctx32_t *x, u4 seed) {
 	x->a = seed*random();
 	x->b = x->c = x->d = seed;
 
-	for (uint16_t i=seed; i>0; --i) { (void)ranval32(x); }
+	for (int i=0; i<RANINIT_ROUNDS; ++i) { (void)ranval32(x); }
+}
+void raninit32_n(ranctx32_t *x, u4 const *seed, size_t n) {
+	for (size_t j=0; j<n; ++j) {
+		x[j].a = seed[j]*random();
+		x[j].b = x[j].c = x[j].d = seed[j];
+	}
+	for (size_t j=0; j<n; j+=RANINIT_BLOCK) {
+		size_t const m = n-j < RANINIT_BLOCK ? n-j : RANINIT_BLOCK;
+		for (int i=0; i<RANINIT_ROUNDS; ++i) {
+			for (size_t k=0; k<m; ++k) { (void)ranval32(&x[j+k]); }
+		}
+	}
 }
 
 u8 ranval64(ranctx64_t *x) {
@@ -86,11 +151,29 @@ u8 ranval64(ranctx64_t *x) {
 	x->c = x->d + e;
 	return x->d = e + x->a;
 }
+void ranfill64(ranctx64_t *x, void *buf, size_t n) {
+	ranctx64_t r = *x;
+	u8 *out = buf;
+	for (size_t i=0; i<n; ++i) { out[i] = ranval64(&r); }
+	*x = r;
+}
 void raninit64(ranctx64_t *x, u8 seed) {
 	x->a = seed*random();
 	x->b = x->c = x->d = seed;
 
-	for (uint16_t i=seed; i>0; --i) { (void)ranval64(x); }
+	for (int i=0; i<RANINIT_ROUNDS; ++i) { (void)ranval64(x); }
+}
+void raninit64_n(ranctx64_t *x, u8 const *seed, size_t n) {
+	for (size_t j=0; j<n; ++j) {
+		x[j].a = seed[j]*random();
+		x[j].b = x[j].c = x[j].d = seed[j];
+	}
+	for (size_t j=0; j<n; j+=RANINIT_BLOCK) {
+		size_t const m = n-j < RANINIT_BLOCK ? n-j : RANINIT_BLOCK;
+		for (int i=0; i<RANINIT_ROUNDS; ++i) {
+			for (size_t k=0; k<m; ++k) { (void)ranval64(&x[j+k]); }
+		}
+	}
 }
 
 int main(int argc, char **argv) {
@@ -106,24 +189,19 @@ int main(int argc, char **argv) {
 	raninit32(&rng32, random());
 	raninit64(&rng64, random());
 
-	for (uint8_t i=0; i<8; ++i) {
-		for (uint8_t j=0; j<2; ++j)
-		{ printf("0x%02x 0x%02x 0x%02x 0x%02x ", ranval8(&rng8), ranval8(&rng8), ranval8(&rng8), ranval8(&rng8)); }
-		printf("\n");
-	}
-	for (uint8_t i=0; i<8; ++i) {
-		for (uint8_t j=0; j<2; ++j)
-		{ printf("0x%04hx 0x%04hx 0x%04hx 0x%04hx ", ranval16(&rng16), ranval16(&rng16), ranval16(&rng16), ranval16(&rng16)); }
-		printf("\n");
-	}
-	for (uint8_t i=0; i<8; ++i) {
-		for (uint8_t j=0; j<2; ++j)
-		{ printf("0x%08x 0x%08x 0x%08x 0x%08x ", ranval32(&rng32), ranval32(&rng32), ranval32(&rng32), ranval32(&rng32)); }
-		printf("\n");
-	}
-	for (uint8_t i=0; i<16; ++i) {
-		printf("0x%016llx 0x%016llx 0x%016llx 0x%016llx\n", ranval64(&rng64), ranval64(&rng64), ranval64(&rng64), ranval64(&rng64));
-	}
+	u1 val8[128];
+	u2 val16[128];
+	u4 val32[128];
+	u8 val64[64];
+	ranfill8(&rng8, val8, 128);
+	ranfill16(&rng16, val16, 128);
+	ranfill32(&rng32, val32, 128);
+	ranfill64(&rng64, val64, 64);
+
+	for (uint8_t i=0; i<128; ++i) { printf("0x%02x%s", val8[i], (i%16 == 15) ? "\n" : " "); }
+	for (uint8_t i=0; i<128; ++i) { printf("0x%04hx%s", val16[i], (i%16 == 15) ? "\n" : " "); }
+	for (uint8_t i=0; i<128; ++i) { printf("0x%08x%s", val32[i], (i%16 == 15) ? "\n" : " "); }
+	for (uint8_t i=0; i<64; ++i) { printf("0x%016llx%s", (unsigned long long)val64[i], (i%4 == 3) ? "\n" : " "); }
 
 	return 0;
 }
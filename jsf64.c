@@ -35,11 +35,12 @@ u8 ranval(ranctx_t *x) {
 	return x->d = e + x->a;
 }
 
+#define RANINIT_ROUNDS 20 // same warm-up as jsf.c
 void raninit(ranctx_t *x, u8 seed) {
 	x->a = seed*random();
 	x->b = x->c = x->d = seed;
 
-	for (uint16_t i=seed; i>0; --i) { (void)ranval(x); }
+	for (int i=0; i<RANINIT_ROUNDS; ++i) { (void)ranval(x); }
 }
 
 int main(int argc, char **argv) {
@@ -20,8 +20,8 @@
  */
  
 /* This code provides a mechanism for getting external randomness for 
- * seeding purposes.  Usually, it's just a wrapper around reading
- * /dev/random.
+ * seeding purposes.  Usually, it's just a wrapper around getrandom(2) or
+ * reading /dev/urandom, with small requests served from a shared pool.
  *
  * Alas, because not every system provides /dev/random, we need a fallback.
  * We also need to try to test whether or not to use the fallback.
@@ -52,30 +52,224 @@
 #define HAVE_DEV_RANDOM         IS_UNIX
 #endif
 
+/* If HAVE_GETRANDOM is set, we use that value, otherwise we guess */
+#ifndef HAVE_GETRANDOM
+#if HAVE_DEV_RANDOM && defined(__linux__) && defined(__GLIBC__) \
+        && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 25))
+    #define HAVE_GETRANDOM      1
+#else
+    #define HAVE_GETRANDOM      0
+#endif
+#endif
+
 #if HAVE_DEV_RANDOM
+    #include <errno.h>
     #include <fcntl.h>
+    #include <string.h>
     #include <unistd.h>
+    #include <pthread.h>
+#endif
+
+#if HAVE_GETRANDOM
+    #include <sys/random.h>
+#endif
+
+/* Atomics for the entropy pool, which is left out without them. */
+#if __GNUC__ || __clang__
+    #define ENTROPY_POOL            1
+    typedef uint64_t                entropy_atomic64_t;
+    typedef int                     entropy_atomic_int_t;
+    #define ENTROPY_LOAD(p)         __atomic_load_n(p, __ATOMIC_ACQUIRE)
+    #define ENTROPY_STORE(p, v)     __atomic_store_n(p, v, __ATOMIC_RELEASE)
+    #define ENTROPY_CAS(p, e, d)    __atomic_compare_exchange_n(p, e, d, \
+                                        false, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+    #define ENTROPY_FENCE()         __atomic_thread_fence(__ATOMIC_ACQUIRE)
+#elif __STDC_VERSION__ >= 201112L && !__STDC_NO_ATOMICS__
+    #include <stdatomic.h>
+    #define ENTROPY_POOL            1
+    typedef atomic_uint_least64_t   entropy_atomic64_t;
+    typedef atomic_int              entropy_atomic_int_t;
+    #define ENTROPY_LOAD(p)         atomic_load(p)
+    #define ENTROPY_STORE(p, v)     atomic_store(p, v)
+    #define ENTROPY_CAS(p, e, d)    atomic_compare_exchange_strong(p, e, d)
+    #define ENTROPY_FENCE()         atomic_thread_fence(memory_order_acquire)
+#else
+    #define ENTROPY_POOL            0
+#endif
+
+#if HAVE_DEV_RANDOM
+#if ENTROPY_POOL
+/* /dev/urandom is opened once, on first need, and kept open.  The
+ * application must not close that descriptor (for instance by closing
+ * every fd above stderr after a fork); later reads would then fail, or
+ * read whatever file reused the number.
+ */
+
+static entropy_atomic_int_t entropy_fd = -1;
+
+static int entropy_getfd(void)
+{
+    int fd = ENTROPY_LOAD(&entropy_fd);
+    if (fd >= 0)
+        return fd;
+#ifdef O_CLOEXEC
+    fd = open("/dev/urandom", O_RDONLY | O_CLOEXEC);
+#else
+    fd = open("/dev/urandom", O_RDONLY);
+#endif
+    if (fd < 0)
+        return -1;
+    int expected = -1;
+    if (!ENTROPY_CAS(&entropy_fd, &expected, fd)) {
+        close(fd);                      /* Another thread got there first */
+        fd = expected;
+    }
+    return fd;
+}
+#else
+static int entropy_getfd(void)
+{
+    return open("/dev/urandom", O_RDONLY);
+}
+#endif
+
+/* entropy_read(dest, size):
+ *     Fill dest straight from the kernel, with getrandom(2) where it is
+ *     available and /dev/urandom otherwise.  Returns false on failure.
+ */
+
+static bool entropy_read(void* dest, size_t size)
+{
+    char* dest_cp = (char*) dest;
+#if HAVE_GETRANDOM
+    while (size > 0) {
+        ssize_t sz = getrandom(dest_cp, size, 0);
+        if (sz < 0) {
+            if (errno == EINTR)
+                continue;
+            if (errno == ENOSYS)        /* Older kernel, use the device */
+                break;
+            return false;
+        }
+        dest_cp += sz;
+        size -= sz;
+    }
+    if (size == 0)
+        return true;
+#endif
+    int fd = entropy_getfd();
+    if (fd < 0)
+        return false;
+    while (size > 0) {
+        ssize_t sz = read(fd, dest_cp, size);
+        if (sz < 0 && errno == EINTR)
+            continue;
+        if (sz <= 0)
+            break;
+        dest_cp += sz;
+        size -= sz;
+    }
+#if !ENTROPY_POOL
+    close(fd);
 #endif
+    return size == 0;
+}
+
+#if ENTROPY_POOL
+/* The entropy pool:
+ *     Small requests are served from a buffer filled ENTROPY_POOL_SIZE
+ *     bytes at a time, so seeding many generators costs one system call
+ *     per buffer rather than three per seed.
+ *
+ *     entropy_state holds a generation count in its high half and the
+ *     bytes already handed out in its low half.  Callers claim a slice
+ *     by advancing it with compare-and-swap, so they never wait on each
+ *     other.  The caller that finds the buffer used up marks it BUSY and
+ *     refills the other of two buffers, and anyone arriving meanwhile
+ *     reads from the kernel directly instead of waiting.  A buffer is
+ *     only rewritten two generations after it was handed out from, and
+ *     a caller that sees that happen while copying retries.
+ *
+ *     A forked child would hand out the same bytes as its parent, so
+ *     the child's pool is marked used up.
+ */
+
+#define ENTROPY_POOL_SIZE       4096
+#define ENTROPY_POOL_BUSY       0xffffffffu
+
+static unsigned char entropy_pool[2][ENTROPY_POOL_SIZE];
+static entropy_atomic64_t entropy_state = ENTROPY_POOL_SIZE;
+static entropy_atomic_int_t entropy_atfork_registered = 0;
+
+static void entropy_atfork_child(void)
+{
+    uint64_t state = ENTROPY_LOAD(&entropy_state);
+    ENTROPY_STORE(&entropy_state,
+                  (((state >> 32) + 2) << 32) | ENTROPY_POOL_SIZE);
+}
 
-#if HAVE_DEV_RANDOM 
 /* entropy_getbytes(dest, size):
- *     Use /dev/urandom to get some external entropy for seeding purposes.
+ *     Get some external entropy for seeding purposes, from the pool for
+ *     small requests and directly from the kernel for large ones.
  *
  * Note:
- *     If reading /dev/urandom fails (which ought to never happen), it returns
- *     false, otherwise it returns true.  If it fails, you could instead call
- *     fallback_entropy_getbytes which always succeeds.
+ *     If reading the system's randomness fails (which ought to never
+ *     happen), it returns false, otherwise it returns true.  If it fails,
+ *     you could instead call fallback_entropy_getbytes which always
+ *     succeeds.
  */
 
 bool entropy_getbytes(void* dest, size_t size)
 {
-    int fd = open("/dev/urandom", O_RDONLY);
-    if (fd < 0)
-        return false;
-    ssize_t sz = read(fd, dest, size);
-    return (close(fd) == 0) && (sz == (ssize_t) size);
+    if (size > ENTROPY_POOL_SIZE / 4)
+        return entropy_read(dest, size);
+
+    int expected = 0;
+    if (ENTROPY_LOAD(&entropy_atfork_registered) == 0
+        && ENTROPY_CAS(&entropy_atfork_registered, &expected, 1))
+        pthread_atfork(NULL, NULL, entropy_atfork_child);
+
+    for (;;) {
+        uint64_t state = ENTROPY_LOAD(&entropy_state);
+        uint32_t gen = state >> 32;
+        uint32_t used = (uint32_t) state;
+        if (used == ENTROPY_POOL_BUSY)
+            return entropy_read(dest, size);
+        if (used + size <= ENTROPY_POOL_SIZE) {
+            if (!ENTROPY_CAS(&entropy_state, &state, state + size))
+                continue;
+            memcpy(dest, entropy_pool[gen & 1] + used, size);
+            ENTROPY_FENCE();
+            if ((uint32_t) (ENTROPY_LOAD(&entropy_state) >> 32) - gen < 2)
+                return true;
+            continue;
+        }
+        uint64_t next = (uint64_t) (gen + 1) << 32;
+        if (!ENTROPY_CAS(&entropy_state, &state, next | ENTROPY_POOL_BUSY))
+            continue;
+        bool ok = entropy_read(entropy_pool[(gen + 1) & 1], ENTROPY_POOL_SIZE);
+        ENTROPY_STORE(&entropy_state, next | (ok ? 0 : ENTROPY_POOL_SIZE));
+        if (!ok)
+            return false;
+    }
 }
 #else
+/* entropy_getbytes(dest, size):
+ *     Use the system's randomness to get some external entropy for
+ *     seeding purposes.
+ *
+ * Note:
+ *     If reading it fails (which ought to never happen), it returns
+ *     false, otherwise it returns true.  If it fails, you could instead
+ *     call fallback_entropy_getbytes which always succeeds.
+ */
+
+bool entropy_getbytes(void* dest, size_t size)
+{
+    return entropy_read(dest, size);
+}
+#endif
+#else
 bool entropy_getbytes(void* dest, size_t size)
 {
     fallback_entropy_getbytes(dest, size);
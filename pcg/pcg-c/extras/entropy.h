@@ -28,6 +28,9 @@
 extern "C" {
 #endif
 
+/* entropy_getbytes keeps a descriptor for /dev/urandom open between
+ * calls where it cannot use getrandom(2); do not close it behind its back.
+ */
 extern bool entropy_getbytes(void* dest, size_t size);
 extern void fallback_entropy_getbytes(void* dest, size_t size);
 
@@ -37,6 +37,7 @@
 #define PCG_VARIANTS_H_INCLUDED 1
 
 #include <inttypes.h>
+#include <stddef.h>
 
 #if __SIZEOF_INT128__
     typedef __uint128_t pcg128_t;
@@ -45,6 +46,20 @@
     #define PCG_HAS_128BIT_OPS 1
 #endif
 
+/*
+ * Thread-local storage, needed by the per-thread global generators
+ * (pcg32_random_tl() and friends), which are only provided with it.
+ */
+#ifndef PCG_HAS_THREAD_LOCAL
+    #if __GNUC__ || __clang__
+        #define PCG_THREAD_LOCAL __thread
+        #define PCG_HAS_THREAD_LOCAL 1
+    #elif __STDC_VERSION__ >= 201112L && !__STDC_NO_ATOMICS__
+        #define PCG_THREAD_LOCAL _Thread_local
+        #define PCG_HAS_THREAD_LOCAL 1
+    #endif
+#endif
+
 #if __GNUC_GNU_INLINE__  &&  !defined(__cplusplus)
     #error Nonstandard GNU inlining semantics. Compile with -std=c99 or better.
     /* We could instead use macros PCG_INLINE and PCG_EXTERN_INLINE
@@ -662,6 +677,103 @@ inline void pcg_setseq_128_advance_r(struct pcg_state_setseq_128* rng,
 }
 #endif
 
+/* Block partitioning of one sequence among workers.  Worker k gets the
+ * generator advanced by k * blocksize, so workers that each draw
+ * blocksize values reproduce the single-generator sequence exactly,
+ * however many of them there are.  The jump by one block is computed
+ * once with pcg_advance_lcg_* and cached as the affine map (acc_mult,
+ * acc_plus) on the state.  Handing out successive workers then costs a
+ * multiply-add each, and worker k on its own O(log k) steps of that map.
+ */
+
+struct pcg_partition_setseq_64 {
+    struct pcg_state_setseq_64 base;
+    uint64_t acc_mult;
+    uint64_t acc_plus;
+};
+
+#if PCG_HAS_128BIT_OPS
+struct pcg_partition_setseq_128 {
+    struct pcg_state_setseq_128 base;
+    pcg128_t acc_mult;
+    pcg128_t acc_plus;
+};
+#endif
+
+inline void pcg_setseq_64_partition_r(struct pcg_partition_setseq_64* part,
+                                      const struct pcg_state_setseq_64* rng,
+                                      uint64_t blocksize)
+{
+    part->base = *rng;
+    part->acc_plus = pcg_advance_lcg_64(0u, blocksize,
+                                        PCG_DEFAULT_MULTIPLIER_64, rng->inc);
+    part->acc_mult = pcg_advance_lcg_64(1u, blocksize,
+                                        PCG_DEFAULT_MULTIPLIER_64, rng->inc)
+                     - part->acc_plus;
+}
+
+inline void
+pcg_setseq_64_partition_block_r(const struct pcg_partition_setseq_64* part,
+                                uint64_t k, struct pcg_state_setseq_64* rng)
+{
+    rng->state = pcg_advance_lcg_64(part->base.state, k, part->acc_mult,
+                                    part->acc_plus);
+    rng->inc = part->base.inc;
+}
+
+inline void
+pcg_setseq_64_partition_fill_r(const struct pcg_partition_setseq_64* part,
+                               uint64_t first,
+                               struct pcg_state_setseq_64* rngs, size_t n)
+{
+    struct pcg_state_setseq_64 rng;
+    pcg_setseq_64_partition_block_r(part, first, &rng);
+    for (size_t i = 0; i < n; ++i) {
+        rngs[i] = rng;
+        rng.state = rng.state * part->acc_mult + part->acc_plus;
+    }
+}
+
+#if PCG_HAS_128BIT_OPS
+inline void pcg_setseq_128_partition_r(struct pcg_partition_setseq_128* part,
+                                       const struct pcg_state_setseq_128* rng,
+                                       pcg128_t blocksize)
+{
+    part->base = *rng;
+    part->acc_plus = pcg_advance_lcg_128(0u, blocksize,
+                                         PCG_DEFAULT_MULTIPLIER_128, rng->inc);
+    part->acc_mult = pcg_advance_lcg_128(1u, blocksize,
+                                         PCG_DEFAULT_MULTIPLIER_128, rng->inc)
+                     - part->acc_plus;
+}
+#endif
+
+#if PCG_HAS_128BIT_OPS
+inline void
+pcg_setseq_128_partition_block_r(const struct pcg_partition_setseq_128* part,
+                                 pcg128_t k, struct pcg_state_setseq_128* rng)
+{
+    rng->state = pcg_advance_lcg_128(part->base.state, k, part->acc_mult,
+                                     part->acc_plus);
+    rng->inc = part->base.inc;
+}
+#endif
+
+#if PCG_HAS_128BIT_OPS
+inline void
+pcg_setseq_128_partition_fill_r(const struct pcg_partition_setseq_128* part,
+                                pcg128_t first,
+                                struct pcg_state_setseq_128* rngs, size_t n)
+{
+    struct pcg_state_setseq_128 rng;
+    pcg_setseq_128_partition_block_r(part, first, &rng);
+    for (size_t i = 0; i < n; ++i) {
+        rngs[i] = rng;
+        rng.state = rng.state * part->acc_mult + part->acc_plus;
+    }
+}
+#endif
+
 /* Functions to seed the RNG state, one version for each size and each
  * style.  Unlike the step functions, regular users can and should call
  * these functions.
@@ -838,6 +950,106 @@ inline void pcg_setseq_128_srandom_r(struct pcg_state_setseq_128* rng,
 }
 #endif
 
+/*
+ * Helpers for the multiply-shift bounded functions.  pcg_mulhilo_64 and
+ * pcg_mulhilo_128 return the high half of the double-width product of a
+ * and b, and store the low half in *lo.
+ */
+
+inline uint64_t pcg_mulhilo_64(uint64_t a, uint64_t b, uint64_t* lo)
+{
+#if PCG_HAS_128BIT_OPS
+    pcg128_t m = (pcg128_t)a * b;
+    *lo = (uint64_t)m;
+    return (uint64_t)(m >> 64u);
+#else
+    uint64_t a_lo = (uint32_t)a, a_hi = a >> 32u;
+    uint64_t b_lo = (uint32_t)b, b_hi = b >> 32u;
+    uint64_t ll = a_lo * b_lo, lh = a_lo * b_hi;
+    uint64_t hl = a_hi * b_lo, hh = a_hi * b_hi;
+    uint64_t mid = (ll >> 32u) + (uint32_t)lh + (uint32_t)hl;
+    *lo = (mid << 32u) | (uint32_t)ll;
+    return hh + (lh >> 32u) + (hl >> 32u) + (mid >> 32u);
+#endif
+}
+
+#if PCG_HAS_128BIT_OPS
+inline pcg128_t pcg_mulhilo_128(pcg128_t a, pcg128_t b, pcg128_t* lo)
+{
+    pcg128_t a_lo = (uint64_t)a, a_hi = a >> 64u;
+    pcg128_t b_lo = (uint64_t)b, b_hi = b >> 64u;
+    pcg128_t ll = a_lo * b_lo, lh = a_lo * b_hi;
+    pcg128_t hl = a_hi * b_lo, hh = a_hi * b_hi;
+    pcg128_t mid = (ll >> 64u) + (uint64_t)lh + (uint64_t)hl;
+    *lo = (mid << 64u) | (uint64_t)ll;
+    return hh + (lh >> 64u) + (hl >> 64u) + (mid >> 64u);
+}
+#endif
+
+/*
+ * A bound with its rejection threshold worked out once, for drawing
+ * many values below the same bound with boundedrand_fixed_r.
+ */
+
+struct pcg_bound_8 {
+    uint8_t bound;
+    uint8_t threshold;
+};
+
+struct pcg_bound_16 {
+    uint16_t bound;
+    uint16_t threshold;
+};
+
+struct pcg_bound_32 {
+    uint32_t bound;
+    uint32_t threshold;
+};
+
+struct pcg_bound_64 {
+    uint64_t bound;
+    uint64_t threshold;
+};
+
+#if PCG_HAS_128BIT_OPS
+struct pcg_bound_128 {
+    pcg128_t bound;
+    pcg128_t threshold;
+};
+#endif
+
+inline void pcg_bound_8_init(struct pcg_bound_8* b, uint8_t bound)
+{
+    b->bound = bound;
+    b->threshold = ((uint8_t)(-bound)) % bound;
+}
+
+inline void pcg_bound_16_init(struct pcg_bound_16* b, uint16_t bound)
+{
+    b->bound = bound;
+    b->threshold = ((uint16_t)(-bound)) % bound;
+}
+
+inline void pcg_bound_32_init(struct pcg_bound_32* b, uint32_t bound)
+{
+    b->bound = bound;
+    b->threshold = -bound % bound;
+}
+
+inline void pcg_bound_64_init(struct pcg_bound_64* b, uint64_t bound)
+{
+    b->bound = bound;
+    b->threshold = -bound % bound;
+}
+
+#if PCG_HAS_128BIT_OPS
+inline void pcg_bound_128_init(struct pcg_bound_128* b, pcg128_t bound)
+{
+    b->bound = bound;
+    b->threshold = -bound % bound;
+}
+#endif
+
 /* Now, finally we create each of the individual generators. We provide
  * a random_r function that provides a random number of the appropriate
  * type (using the full range of the type) and a boundedrand_r version
@@ -865,6 +1077,17 @@ inline void pcg_setseq_128_srandom_r(struct pcg_state_setseq_128* rng,
  *     Empricical tests show that division is preferable to modulus for
  *     reducting the range of an RNG.  It's faster, and sometimes it can
  *     even be statistically prefereable.
+ *
+ * Implementation notes for boundedrand_mul_r and boundedrand_fixed_r:
+ *
+ *     These use Lemire's multiply-shift reduction instead.  The result
+ *     is the high half of r * bound, and a draw is rejected when the
+ *     low half falls below the same threshold as above.  The low half
+ *     is only compared with the threshold when it is below bound, so
+ *     boundedrand_mul_r almost never divides, and boundedrand_fixed_r
+ *     takes its threshold from a struct pcg_bound_N that was set up
+ *     once by pcg_bound_N_init.  They return different values from
+ *     boundedrand_r for the same generator state.
  */
 
 /* Generation functions for XSH RS */
@@ -887,6 +1110,40 @@ inline uint8_t pcg_oneseq_16_xsh_rs_8_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint8_t
+pcg_oneseq_16_xsh_rs_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                         uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_oneseq_16_xsh_rs_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_oneseq_16_xsh_rs_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_oneseq_16_xsh_rs_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                           const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_oneseq_16_xsh_rs_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_oneseq_16_xsh_rs_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    struct pcg_state_16 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_16_xsh_rs_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t pcg_oneseq_32_xsh_rs_16_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -905,6 +1162,40 @@ inline uint16_t pcg_oneseq_32_xsh_rs_16_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint16_t
+pcg_oneseq_32_xsh_rs_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                          uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_oneseq_32_xsh_rs_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_oneseq_32_xsh_rs_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_oneseq_32_xsh_rs_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                            const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_oneseq_32_xsh_rs_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_oneseq_32_xsh_rs_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    struct pcg_state_32 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_32_xsh_rs_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t pcg_oneseq_64_xsh_rs_32_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -923,6 +1214,40 @@ inline uint32_t pcg_oneseq_64_xsh_rs_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t
+pcg_oneseq_64_xsh_rs_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_oneseq_64_xsh_rs_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_oneseq_64_xsh_rs_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_oneseq_64_xsh_rs_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_oneseq_64_xsh_rs_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_oneseq_64_xsh_rs_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    struct pcg_state_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_64_xsh_rs_32_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_oneseq_128_xsh_rs_64_random_r(struct pcg_state_128* rng)
 {
@@ -943,6 +1268,44 @@ pcg_oneseq_128_xsh_rs_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_oneseq_128_xsh_rs_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound)
+{
+    uint64_t r = pcg_oneseq_128_xsh_rs_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_oneseq_128_xsh_rs_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_oneseq_128_xsh_rs_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_oneseq_128_xsh_rs_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_oneseq_128_xsh_rs_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    struct pcg_state_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_128_xsh_rs_64_random_r(&local);
+    *rng = local;
+}
 #endif
 
 inline uint8_t pcg_unique_16_xsh_rs_8_random_r(struct pcg_state_16* rng)
@@ -963,6 +1326,38 @@ inline uint8_t pcg_unique_16_xsh_rs_8_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint8_t
+pcg_unique_16_xsh_rs_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                         uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_unique_16_xsh_rs_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_unique_16_xsh_rs_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_unique_16_xsh_rs_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                           const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_unique_16_xsh_rs_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_unique_16_xsh_rs_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_16_xsh_rs_8_random_r(rng);
+}
+
 inline uint16_t pcg_unique_32_xsh_rs_16_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -981,6 +1376,38 @@ inline uint16_t pcg_unique_32_xsh_rs_16_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint16_t
+pcg_unique_32_xsh_rs_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                          uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_unique_32_xsh_rs_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_unique_32_xsh_rs_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_unique_32_xsh_rs_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                            const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_unique_32_xsh_rs_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_unique_32_xsh_rs_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_32_xsh_rs_16_random_r(rng);
+}
+
 inline uint32_t pcg_unique_64_xsh_rs_32_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -999,6 +1426,38 @@ inline uint32_t pcg_unique_64_xsh_rs_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t
+pcg_unique_64_xsh_rs_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_unique_64_xsh_rs_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_unique_64_xsh_rs_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_unique_64_xsh_rs_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_unique_64_xsh_rs_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_unique_64_xsh_rs_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_64_xsh_rs_32_random_r(rng);
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_unique_128_xsh_rs_64_random_r(struct pcg_state_128* rng)
 {
@@ -1019,6 +1478,42 @@ pcg_unique_128_xsh_rs_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_unique_128_xsh_rs_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound)
+{
+    uint64_t r = pcg_unique_128_xsh_rs_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_unique_128_xsh_rs_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_unique_128_xsh_rs_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_unique_128_xsh_rs_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_unique_128_xsh_rs_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_128_xsh_rs_64_random_r(rng);
+}
 #endif
 
 inline uint8_t pcg_setseq_16_xsh_rs_8_random_r(struct pcg_state_setseq_16* rng)
@@ -1040,6 +1535,41 @@ pcg_setseq_16_xsh_rs_8_boundedrand_r(struct pcg_state_setseq_16* rng,
     }
 }
 
+inline uint8_t
+pcg_setseq_16_xsh_rs_8_boundedrand_mul_r(struct pcg_state_setseq_16* rng,
+                                         uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_setseq_16_xsh_rs_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_setseq_16_xsh_rs_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_setseq_16_xsh_rs_8_boundedrand_fixed_r(struct pcg_state_setseq_16* rng,
+                                           const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_setseq_16_xsh_rs_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_setseq_16_xsh_rs_8_fill_r(struct pcg_state_setseq_16* rng, void* buf,
+                              size_t n)
+{
+    struct pcg_state_setseq_16 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_16_xsh_rs_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t
 pcg_setseq_32_xsh_rs_16_random_r(struct pcg_state_setseq_32* rng)
 {
@@ -1060,6 +1590,41 @@ pcg_setseq_32_xsh_rs_16_boundedrand_r(struct pcg_state_setseq_32* rng,
     }
 }
 
+inline uint16_t
+pcg_setseq_32_xsh_rs_16_boundedrand_mul_r(struct pcg_state_setseq_32* rng,
+                                          uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_setseq_32_xsh_rs_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_setseq_32_xsh_rs_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_setseq_32_xsh_rs_16_boundedrand_fixed_r(struct pcg_state_setseq_32* rng,
+                                            const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_setseq_32_xsh_rs_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_setseq_32_xsh_rs_16_fill_r(struct pcg_state_setseq_32* rng, void* buf,
+                               size_t n)
+{
+    struct pcg_state_setseq_32 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_32_xsh_rs_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t
 pcg_setseq_64_xsh_rs_32_random_r(struct pcg_state_setseq_64* rng)
 {
@@ -1080,6 +1645,41 @@ pcg_setseq_64_xsh_rs_32_boundedrand_r(struct pcg_state_setseq_64* rng,
     }
 }
 
+inline uint32_t
+pcg_setseq_64_xsh_rs_32_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                          uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_setseq_64_xsh_rs_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_setseq_64_xsh_rs_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_setseq_64_xsh_rs_32_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                            const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_setseq_64_xsh_rs_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_setseq_64_xsh_rs_32_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                               size_t n)
+{
+    struct pcg_state_setseq_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_64_xsh_rs_32_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t
 pcg_setseq_128_xsh_rs_64_random_r(struct pcg_state_setseq_128* rng)
@@ -1101,6 +1701,45 @@ pcg_setseq_128_xsh_rs_64_boundedrand_r(struct pcg_state_setseq_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_setseq_128_xsh_rs_64_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                           uint64_t bound)
+{
+    uint64_t r = pcg_setseq_128_xsh_rs_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_setseq_128_xsh_rs_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_setseq_128_xsh_rs_64_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                             const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_setseq_128_xsh_rs_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_setseq_128_xsh_rs_64_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                                size_t n)
+{
+    struct pcg_state_setseq_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_128_xsh_rs_64_random_r(&local);
+    *rng = local;
+}
 #endif
 
 inline uint8_t pcg_mcg_16_xsh_rs_8_random_r(struct pcg_state_16* rng)
@@ -1121,6 +1760,39 @@ inline uint8_t pcg_mcg_16_xsh_rs_8_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint8_t pcg_mcg_16_xsh_rs_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                                     uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_mcg_16_xsh_rs_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_mcg_16_xsh_rs_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_mcg_16_xsh_rs_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                        const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_mcg_16_xsh_rs_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_mcg_16_xsh_rs_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    struct pcg_state_16 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_16_xsh_rs_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t pcg_mcg_32_xsh_rs_16_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -1139,6 +1811,39 @@ inline uint16_t pcg_mcg_32_xsh_rs_16_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint16_t pcg_mcg_32_xsh_rs_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                                       uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_mcg_32_xsh_rs_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_mcg_32_xsh_rs_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_mcg_32_xsh_rs_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                         const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_mcg_32_xsh_rs_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_mcg_32_xsh_rs_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    struct pcg_state_32 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_32_xsh_rs_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t pcg_mcg_64_xsh_rs_32_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -1157,6 +1862,55 @@ inline uint32_t pcg_mcg_64_xsh_rs_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t pcg_mcg_64_xsh_rs_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                                       uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_mcg_64_xsh_rs_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_mcg_64_xsh_rs_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_mcg_64_xsh_rs_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                         const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_mcg_64_xsh_rs_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_mcg_64_xsh_rs_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    struct pcg_state_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_64_xsh_rs_32_random_r(&local);
+    *rng = local;
+}
+
+inline void
+pcg_mcg_64_xsh_rs_32_boundedrand_fill_r(struct pcg_state_64* rng,
+                                        uint32_t bound, uint32_t* out, size_t n)
+{
+    uint32_t threshold = -bound % bound;
+    struct pcg_state_64 local = *rng;
+    size_t i = 0;
+    while (i < n) {
+        uint32_t r = pcg_mcg_64_xsh_rs_32_random_r(&local);
+        uint64_t m = (uint64_t)r * bound;
+        out[i] = m >> 32;
+        i += (uint32_t)m >= threshold;
+    }
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_mcg_128_xsh_rs_64_random_r(struct pcg_state_128* rng)
 {
@@ -1176,6 +1930,44 @@ inline uint64_t pcg_mcg_128_xsh_rs_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_mcg_128_xsh_rs_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                        uint64_t bound)
+{
+    uint64_t r = pcg_mcg_128_xsh_rs_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_mcg_128_xsh_rs_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_mcg_128_xsh_rs_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                          const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_mcg_128_xsh_rs_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_mcg_128_xsh_rs_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    struct pcg_state_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_128_xsh_rs_64_random_r(&local);
+    *rng = local;
+}
 #endif
 
 /* Generation functions for XSH RR */
@@ -1198,6 +1990,40 @@ inline uint8_t pcg_oneseq_16_xsh_rr_8_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint8_t
+pcg_oneseq_16_xsh_rr_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                         uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_oneseq_16_xsh_rr_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_oneseq_16_xsh_rr_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_oneseq_16_xsh_rr_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                           const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_oneseq_16_xsh_rr_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_oneseq_16_xsh_rr_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    struct pcg_state_16 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_16_xsh_rr_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t pcg_oneseq_32_xsh_rr_16_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -1216,6 +2042,40 @@ inline uint16_t pcg_oneseq_32_xsh_rr_16_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint16_t
+pcg_oneseq_32_xsh_rr_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                          uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_oneseq_32_xsh_rr_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_oneseq_32_xsh_rr_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_oneseq_32_xsh_rr_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                            const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_oneseq_32_xsh_rr_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_oneseq_32_xsh_rr_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    struct pcg_state_32 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_32_xsh_rr_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t pcg_oneseq_64_xsh_rr_32_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -1234,6 +2094,57 @@ inline uint32_t pcg_oneseq_64_xsh_rr_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t
+pcg_oneseq_64_xsh_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_oneseq_64_xsh_rr_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_oneseq_64_xsh_rr_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_oneseq_64_xsh_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_oneseq_64_xsh_rr_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_oneseq_64_xsh_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    struct pcg_state_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_64_xsh_rr_32_random_r(&local);
+    *rng = local;
+}
+
+inline void
+pcg_oneseq_64_xsh_rr_32_boundedrand_fill_r(struct pcg_state_64* rng,
+                                           uint32_t bound, uint32_t* out,
+                                           size_t n)
+{
+    uint32_t threshold = -bound % bound;
+    struct pcg_state_64 local = *rng;
+    size_t i = 0;
+    while (i < n) {
+        uint32_t r = pcg_oneseq_64_xsh_rr_32_random_r(&local);
+        uint64_t m = (uint64_t)r * bound;
+        out[i] = m >> 32;
+        i += (uint32_t)m >= threshold;
+    }
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_oneseq_128_xsh_rr_64_random_r(struct pcg_state_128* rng)
 {
@@ -1254,6 +2165,44 @@ pcg_oneseq_128_xsh_rr_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_oneseq_128_xsh_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound)
+{
+    uint64_t r = pcg_oneseq_128_xsh_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_oneseq_128_xsh_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_oneseq_128_xsh_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_oneseq_128_xsh_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_oneseq_128_xsh_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    struct pcg_state_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_128_xsh_rr_64_random_r(&local);
+    *rng = local;
+}
 #endif
 
 inline uint8_t pcg_unique_16_xsh_rr_8_random_r(struct pcg_state_16* rng)
@@ -1274,6 +2223,38 @@ inline uint8_t pcg_unique_16_xsh_rr_8_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint8_t
+pcg_unique_16_xsh_rr_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                         uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_unique_16_xsh_rr_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_unique_16_xsh_rr_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_unique_16_xsh_rr_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                           const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_unique_16_xsh_rr_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_unique_16_xsh_rr_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_16_xsh_rr_8_random_r(rng);
+}
+
 inline uint16_t pcg_unique_32_xsh_rr_16_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -1292,6 +2273,38 @@ inline uint16_t pcg_unique_32_xsh_rr_16_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint16_t
+pcg_unique_32_xsh_rr_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                          uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_unique_32_xsh_rr_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_unique_32_xsh_rr_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_unique_32_xsh_rr_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                            const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_unique_32_xsh_rr_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_unique_32_xsh_rr_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_32_xsh_rr_16_random_r(rng);
+}
+
 inline uint32_t pcg_unique_64_xsh_rr_32_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -1310,6 +2323,53 @@ inline uint32_t pcg_unique_64_xsh_rr_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t
+pcg_unique_64_xsh_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_unique_64_xsh_rr_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_unique_64_xsh_rr_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_unique_64_xsh_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_unique_64_xsh_rr_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_unique_64_xsh_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_64_xsh_rr_32_random_r(rng);
+}
+
+inline void
+pcg_unique_64_xsh_rr_32_boundedrand_fill_r(struct pcg_state_64* rng,
+                                           uint32_t bound, uint32_t* out,
+                                           size_t n)
+{
+    uint32_t threshold = -bound % bound;
+    size_t i = 0;
+    while (i < n) {
+        uint32_t r = pcg_unique_64_xsh_rr_32_random_r(rng);
+        uint64_t m = (uint64_t)r * bound;
+        out[i] = m >> 32;
+        i += (uint32_t)m >= threshold;
+    }
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_unique_128_xsh_rr_64_random_r(struct pcg_state_128* rng)
 {
@@ -1330,6 +2390,42 @@ pcg_unique_128_xsh_rr_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_unique_128_xsh_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound)
+{
+    uint64_t r = pcg_unique_128_xsh_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_unique_128_xsh_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_unique_128_xsh_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_unique_128_xsh_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_unique_128_xsh_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_128_xsh_rr_64_random_r(rng);
+}
 #endif
 
 inline uint8_t pcg_setseq_16_xsh_rr_8_random_r(struct pcg_state_setseq_16* rng)
@@ -1351,6 +2447,41 @@ pcg_setseq_16_xsh_rr_8_boundedrand_r(struct pcg_state_setseq_16* rng,
     }
 }
 
+inline uint8_t
+pcg_setseq_16_xsh_rr_8_boundedrand_mul_r(struct pcg_state_setseq_16* rng,
+                                         uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_setseq_16_xsh_rr_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_setseq_16_xsh_rr_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_setseq_16_xsh_rr_8_boundedrand_fixed_r(struct pcg_state_setseq_16* rng,
+                                           const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_setseq_16_xsh_rr_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_setseq_16_xsh_rr_8_fill_r(struct pcg_state_setseq_16* rng, void* buf,
+                              size_t n)
+{
+    struct pcg_state_setseq_16 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_16_xsh_rr_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t
 pcg_setseq_32_xsh_rr_16_random_r(struct pcg_state_setseq_32* rng)
 {
@@ -1371,6 +2502,41 @@ pcg_setseq_32_xsh_rr_16_boundedrand_r(struct pcg_state_setseq_32* rng,
     }
 }
 
+inline uint16_t
+pcg_setseq_32_xsh_rr_16_boundedrand_mul_r(struct pcg_state_setseq_32* rng,
+                                          uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_setseq_32_xsh_rr_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_setseq_32_xsh_rr_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_setseq_32_xsh_rr_16_boundedrand_fixed_r(struct pcg_state_setseq_32* rng,
+                                            const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_setseq_32_xsh_rr_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_setseq_32_xsh_rr_16_fill_r(struct pcg_state_setseq_32* rng, void* buf,
+                               size_t n)
+{
+    struct pcg_state_setseq_32 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_32_xsh_rr_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t
 pcg_setseq_64_xsh_rr_32_random_r(struct pcg_state_setseq_64* rng)
 {
@@ -1391,6 +2557,58 @@ pcg_setseq_64_xsh_rr_32_boundedrand_r(struct pcg_state_setseq_64* rng,
     }
 }
 
+inline uint32_t
+pcg_setseq_64_xsh_rr_32_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                          uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_setseq_64_xsh_rr_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_setseq_64_xsh_rr_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_setseq_64_xsh_rr_32_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                            const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_setseq_64_xsh_rr_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_setseq_64_xsh_rr_32_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                               size_t n)
+{
+    struct pcg_state_setseq_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_64_xsh_rr_32_random_r(&local);
+    *rng = local;
+}
+
+inline void
+pcg_setseq_64_xsh_rr_32_boundedrand_fill_r(struct pcg_state_setseq_64* rng,
+                                           uint32_t bound, uint32_t* out,
+                                           size_t n)
+{
+    uint32_t threshold = -bound % bound;
+    struct pcg_state_setseq_64 local = *rng;
+    size_t i = 0;
+    while (i < n) {
+        uint32_t r = pcg_setseq_64_xsh_rr_32_random_r(&local);
+        uint64_t m = (uint64_t)r * bound;
+        out[i] = m >> 32;
+        i += (uint32_t)m >= threshold;
+    }
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t
 pcg_setseq_128_xsh_rr_64_random_r(struct pcg_state_setseq_128* rng)
@@ -1412,6 +2630,45 @@ pcg_setseq_128_xsh_rr_64_boundedrand_r(struct pcg_state_setseq_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_setseq_128_xsh_rr_64_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                           uint64_t bound)
+{
+    uint64_t r = pcg_setseq_128_xsh_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_setseq_128_xsh_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_setseq_128_xsh_rr_64_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                             const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_setseq_128_xsh_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_setseq_128_xsh_rr_64_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                                size_t n)
+{
+    struct pcg_state_setseq_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_128_xsh_rr_64_random_r(&local);
+    *rng = local;
+}
 #endif
 
 inline uint8_t pcg_mcg_16_xsh_rr_8_random_r(struct pcg_state_16* rng)
@@ -1432,6 +2689,39 @@ inline uint8_t pcg_mcg_16_xsh_rr_8_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint8_t pcg_mcg_16_xsh_rr_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                                     uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_mcg_16_xsh_rr_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_mcg_16_xsh_rr_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_mcg_16_xsh_rr_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                        const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_mcg_16_xsh_rr_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_mcg_16_xsh_rr_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    struct pcg_state_16 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_16_xsh_rr_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t pcg_mcg_32_xsh_rr_16_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -1450,6 +2740,39 @@ inline uint16_t pcg_mcg_32_xsh_rr_16_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint16_t pcg_mcg_32_xsh_rr_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                                       uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_mcg_32_xsh_rr_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_mcg_32_xsh_rr_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_mcg_32_xsh_rr_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                         const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_mcg_32_xsh_rr_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_mcg_32_xsh_rr_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    struct pcg_state_32 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_32_xsh_rr_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t pcg_mcg_64_xsh_rr_32_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -1468,6 +2791,39 @@ inline uint32_t pcg_mcg_64_xsh_rr_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t pcg_mcg_64_xsh_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                                       uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_mcg_64_xsh_rr_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_mcg_64_xsh_rr_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_mcg_64_xsh_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                         const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_mcg_64_xsh_rr_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_mcg_64_xsh_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    struct pcg_state_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_64_xsh_rr_32_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_mcg_128_xsh_rr_64_random_r(struct pcg_state_128* rng)
 {
@@ -1487,6 +2843,44 @@ inline uint64_t pcg_mcg_128_xsh_rr_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_mcg_128_xsh_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                        uint64_t bound)
+{
+    uint64_t r = pcg_mcg_128_xsh_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_mcg_128_xsh_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_mcg_128_xsh_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                          const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_mcg_128_xsh_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_mcg_128_xsh_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    struct pcg_state_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_128_xsh_rr_64_random_r(&local);
+    *rng = local;
+}
 #endif
 
 /* Generation functions for RXS M XS (no MCG versions because they
@@ -1511,6 +2905,40 @@ inline uint8_t pcg_oneseq_8_rxs_m_xs_8_boundedrand_r(struct pcg_state_8* rng,
     }
 }
 
+inline uint8_t
+pcg_oneseq_8_rxs_m_xs_8_boundedrand_mul_r(struct pcg_state_8* rng,
+                                          uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_oneseq_8_rxs_m_xs_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_oneseq_8_rxs_m_xs_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_oneseq_8_rxs_m_xs_8_boundedrand_fixed_r(struct pcg_state_8* rng,
+                                            const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_oneseq_8_rxs_m_xs_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_oneseq_8_rxs_m_xs_8_fill_r(struct pcg_state_8* rng, void* buf, size_t n)
+{
+    struct pcg_state_8 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_8_rxs_m_xs_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t pcg_oneseq_16_rxs_m_xs_16_random_r(struct pcg_state_16* rng)
 {
     uint16_t oldstate = rng->state;
@@ -1530,6 +2958,40 @@ pcg_oneseq_16_rxs_m_xs_16_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint16_t
+pcg_oneseq_16_rxs_m_xs_16_boundedrand_mul_r(struct pcg_state_16* rng,
+                                            uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_oneseq_16_rxs_m_xs_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_oneseq_16_rxs_m_xs_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_oneseq_16_rxs_m_xs_16_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                              const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_oneseq_16_rxs_m_xs_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_oneseq_16_rxs_m_xs_16_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    struct pcg_state_16 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_16_rxs_m_xs_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t pcg_oneseq_32_rxs_m_xs_32_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -1549,6 +3011,40 @@ pcg_oneseq_32_rxs_m_xs_32_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint32_t
+pcg_oneseq_32_rxs_m_xs_32_boundedrand_mul_r(struct pcg_state_32* rng,
+                                            uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_oneseq_32_rxs_m_xs_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_oneseq_32_rxs_m_xs_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_oneseq_32_rxs_m_xs_32_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                              const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_oneseq_32_rxs_m_xs_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_oneseq_32_rxs_m_xs_32_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    struct pcg_state_32 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_32_rxs_m_xs_32_random_r(&local);
+    *rng = local;
+}
+
 inline uint64_t pcg_oneseq_64_rxs_m_xs_64_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -1568,6 +3064,44 @@ pcg_oneseq_64_rxs_m_xs_64_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint64_t
+pcg_oneseq_64_rxs_m_xs_64_boundedrand_mul_r(struct pcg_state_64* rng,
+                                            uint64_t bound)
+{
+    uint64_t r = pcg_oneseq_64_rxs_m_xs_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_oneseq_64_rxs_m_xs_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_oneseq_64_rxs_m_xs_64_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                              const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_oneseq_64_rxs_m_xs_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_oneseq_64_rxs_m_xs_64_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    struct pcg_state_64 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_64_rxs_m_xs_64_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline pcg128_t pcg_oneseq_128_rxs_m_xs_128_random_r(struct pcg_state_128* rng)
 {
@@ -1588,6 +3122,45 @@ pcg_oneseq_128_rxs_m_xs_128_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline pcg128_t
+pcg_oneseq_128_rxs_m_xs_128_boundedrand_mul_r(struct pcg_state_128* rng,
+                                              pcg128_t bound)
+{
+    pcg128_t r = pcg_oneseq_128_rxs_m_xs_128_random_r(rng);
+    pcg128_t lo, hi = pcg_mulhilo_128(r, bound, &lo);
+    if (lo < bound) {
+        pcg128_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_oneseq_128_rxs_m_xs_128_random_r(rng);
+            hi = pcg_mulhilo_128(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline pcg128_t
+pcg_oneseq_128_rxs_m_xs_128_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                                const struct pcg_bound_128* b)
+{
+    pcg128_t r, lo, hi;
+    do {
+        r = pcg_oneseq_128_rxs_m_xs_128_random_r(rng);
+        hi = pcg_mulhilo_128(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_oneseq_128_rxs_m_xs_128_fill_r(struct pcg_state_128* rng, void* buf,
+                                   size_t n)
+{
+    struct pcg_state_128 local = *rng;
+    pcg128_t* out = (pcg128_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_128_rxs_m_xs_128_random_r(&local);
+    *rng = local;
+}
 #endif
 
 inline uint16_t pcg_unique_16_rxs_m_xs_16_random_r(struct pcg_state_16* rng)
@@ -1609,6 +3182,38 @@ pcg_unique_16_rxs_m_xs_16_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint16_t
+pcg_unique_16_rxs_m_xs_16_boundedrand_mul_r(struct pcg_state_16* rng,
+                                            uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_unique_16_rxs_m_xs_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_unique_16_rxs_m_xs_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_unique_16_rxs_m_xs_16_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                              const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_unique_16_rxs_m_xs_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_unique_16_rxs_m_xs_16_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_16_rxs_m_xs_16_random_r(rng);
+}
+
 inline uint32_t pcg_unique_32_rxs_m_xs_32_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -1628,6 +3233,38 @@ pcg_unique_32_rxs_m_xs_32_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint32_t
+pcg_unique_32_rxs_m_xs_32_boundedrand_mul_r(struct pcg_state_32* rng,
+                                            uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_unique_32_rxs_m_xs_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_unique_32_rxs_m_xs_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_unique_32_rxs_m_xs_32_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                              const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_unique_32_rxs_m_xs_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_unique_32_rxs_m_xs_32_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_32_rxs_m_xs_32_random_r(rng);
+}
+
 inline uint64_t pcg_unique_64_rxs_m_xs_64_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -1647,6 +3284,42 @@ pcg_unique_64_rxs_m_xs_64_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint64_t
+pcg_unique_64_rxs_m_xs_64_boundedrand_mul_r(struct pcg_state_64* rng,
+                                            uint64_t bound)
+{
+    uint64_t r = pcg_unique_64_rxs_m_xs_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_unique_64_rxs_m_xs_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_unique_64_rxs_m_xs_64_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                              const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_unique_64_rxs_m_xs_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_unique_64_rxs_m_xs_64_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_64_rxs_m_xs_64_random_r(rng);
+}
+
 #if PCG_HAS_128BIT_OPS
 inline pcg128_t pcg_unique_128_rxs_m_xs_128_random_r(struct pcg_state_128* rng)
 {
@@ -1667,6 +3340,43 @@ pcg_unique_128_rxs_m_xs_128_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline pcg128_t
+pcg_unique_128_rxs_m_xs_128_boundedrand_mul_r(struct pcg_state_128* rng,
+                                              pcg128_t bound)
+{
+    pcg128_t r = pcg_unique_128_rxs_m_xs_128_random_r(rng);
+    pcg128_t lo, hi = pcg_mulhilo_128(r, bound, &lo);
+    if (lo < bound) {
+        pcg128_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_unique_128_rxs_m_xs_128_random_r(rng);
+            hi = pcg_mulhilo_128(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline pcg128_t
+pcg_unique_128_rxs_m_xs_128_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                                const struct pcg_bound_128* b)
+{
+    pcg128_t r, lo, hi;
+    do {
+        r = pcg_unique_128_rxs_m_xs_128_random_r(rng);
+        hi = pcg_mulhilo_128(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_unique_128_rxs_m_xs_128_fill_r(struct pcg_state_128* rng, void* buf,
+                                   size_t n)
+{
+    pcg128_t* out = (pcg128_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_128_rxs_m_xs_128_random_r(rng);
+}
 #endif
 
 inline uint8_t pcg_setseq_8_rxs_m_xs_8_random_r(struct pcg_state_setseq_8* rng)
@@ -1688,6 +3398,41 @@ pcg_setseq_8_rxs_m_xs_8_boundedrand_r(struct pcg_state_setseq_8* rng,
     }
 }
 
+inline uint8_t
+pcg_setseq_8_rxs_m_xs_8_boundedrand_mul_r(struct pcg_state_setseq_8* rng,
+                                          uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_setseq_8_rxs_m_xs_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_setseq_8_rxs_m_xs_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_setseq_8_rxs_m_xs_8_boundedrand_fixed_r(struct pcg_state_setseq_8* rng,
+                                            const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_setseq_8_rxs_m_xs_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_setseq_8_rxs_m_xs_8_fill_r(struct pcg_state_setseq_8* rng, void* buf,
+                               size_t n)
+{
+    struct pcg_state_setseq_8 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_8_rxs_m_xs_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t
 pcg_setseq_16_rxs_m_xs_16_random_r(struct pcg_state_setseq_16* rng)
 {
@@ -1708,6 +3453,41 @@ pcg_setseq_16_rxs_m_xs_16_boundedrand_r(struct pcg_state_setseq_16* rng,
     }
 }
 
+inline uint16_t
+pcg_setseq_16_rxs_m_xs_16_boundedrand_mul_r(struct pcg_state_setseq_16* rng,
+                                            uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_setseq_16_rxs_m_xs_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_setseq_16_rxs_m_xs_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_setseq_16_rxs_m_xs_16_boundedrand_fixed_r(struct pcg_state_setseq_16* rng,
+                                              const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_setseq_16_rxs_m_xs_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_setseq_16_rxs_m_xs_16_fill_r(struct pcg_state_setseq_16* rng, void* buf,
+                                 size_t n)
+{
+    struct pcg_state_setseq_16 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_16_rxs_m_xs_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t
 pcg_setseq_32_rxs_m_xs_32_random_r(struct pcg_state_setseq_32* rng)
 {
@@ -1728,6 +3508,41 @@ pcg_setseq_32_rxs_m_xs_32_boundedrand_r(struct pcg_state_setseq_32* rng,
     }
 }
 
+inline uint32_t
+pcg_setseq_32_rxs_m_xs_32_boundedrand_mul_r(struct pcg_state_setseq_32* rng,
+                                            uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_setseq_32_rxs_m_xs_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_setseq_32_rxs_m_xs_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_setseq_32_rxs_m_xs_32_boundedrand_fixed_r(struct pcg_state_setseq_32* rng,
+                                              const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_setseq_32_rxs_m_xs_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_setseq_32_rxs_m_xs_32_fill_r(struct pcg_state_setseq_32* rng, void* buf,
+                                 size_t n)
+{
+    struct pcg_state_setseq_32 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_32_rxs_m_xs_32_random_r(&local);
+    *rng = local;
+}
+
 inline uint64_t
 pcg_setseq_64_rxs_m_xs_64_random_r(struct pcg_state_setseq_64* rng)
 {
@@ -1748,6 +3563,45 @@ pcg_setseq_64_rxs_m_xs_64_boundedrand_r(struct pcg_state_setseq_64* rng,
     }
 }
 
+inline uint64_t
+pcg_setseq_64_rxs_m_xs_64_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                            uint64_t bound)
+{
+    uint64_t r = pcg_setseq_64_rxs_m_xs_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_setseq_64_rxs_m_xs_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_setseq_64_rxs_m_xs_64_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                              const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_setseq_64_rxs_m_xs_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_setseq_64_rxs_m_xs_64_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                                 size_t n)
+{
+    struct pcg_state_setseq_64 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_64_rxs_m_xs_64_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline pcg128_t
 pcg_setseq_128_rxs_m_xs_128_random_r(struct pcg_state_setseq_128* rng)
@@ -1769,6 +3623,45 @@ pcg_setseq_128_rxs_m_xs_128_boundedrand_r(struct pcg_state_setseq_128* rng,
             return r % bound;
     }
 }
+
+inline pcg128_t
+pcg_setseq_128_rxs_m_xs_128_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                              pcg128_t bound)
+{
+    pcg128_t r = pcg_setseq_128_rxs_m_xs_128_random_r(rng);
+    pcg128_t lo, hi = pcg_mulhilo_128(r, bound, &lo);
+    if (lo < bound) {
+        pcg128_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_setseq_128_rxs_m_xs_128_random_r(rng);
+            hi = pcg_mulhilo_128(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline pcg128_t
+pcg_setseq_128_rxs_m_xs_128_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                                const struct pcg_bound_128* b)
+{
+    pcg128_t r, lo, hi;
+    do {
+        r = pcg_setseq_128_rxs_m_xs_128_random_r(rng);
+        hi = pcg_mulhilo_128(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_setseq_128_rxs_m_xs_128_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                                   size_t n)
+{
+    struct pcg_state_setseq_128 local = *rng;
+    pcg128_t* out = (pcg128_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_128_rxs_m_xs_128_random_r(&local);
+    *rng = local;
+}
 #endif
 
 /* Generation functions for RXS M */
@@ -1791,6 +3684,39 @@ inline uint8_t pcg_oneseq_16_rxs_m_8_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint8_t pcg_oneseq_16_rxs_m_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                                       uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_oneseq_16_rxs_m_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_oneseq_16_rxs_m_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_oneseq_16_rxs_m_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                          const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_oneseq_16_rxs_m_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_oneseq_16_rxs_m_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    struct pcg_state_16 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_16_rxs_m_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t pcg_oneseq_32_rxs_m_16_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -1809,6 +3735,40 @@ inline uint16_t pcg_oneseq_32_rxs_m_16_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint16_t
+pcg_oneseq_32_rxs_m_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                         uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_oneseq_32_rxs_m_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_oneseq_32_rxs_m_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_oneseq_32_rxs_m_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                           const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_oneseq_32_rxs_m_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_oneseq_32_rxs_m_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    struct pcg_state_32 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_32_rxs_m_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t pcg_oneseq_64_rxs_m_32_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -1827,6 +3787,40 @@ inline uint32_t pcg_oneseq_64_rxs_m_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t
+pcg_oneseq_64_rxs_m_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                         uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_oneseq_64_rxs_m_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_oneseq_64_rxs_m_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_oneseq_64_rxs_m_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                           const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_oneseq_64_rxs_m_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_oneseq_64_rxs_m_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    struct pcg_state_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_64_rxs_m_32_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_oneseq_128_rxs_m_64_random_r(struct pcg_state_128* rng)
 {
@@ -1846,6 +3840,44 @@ inline uint64_t pcg_oneseq_128_rxs_m_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_oneseq_128_rxs_m_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                          uint64_t bound)
+{
+    uint64_t r = pcg_oneseq_128_rxs_m_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_oneseq_128_rxs_m_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_oneseq_128_rxs_m_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                            const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_oneseq_128_rxs_m_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_oneseq_128_rxs_m_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    struct pcg_state_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_128_rxs_m_64_random_r(&local);
+    *rng = local;
+}
 #endif
 
 inline uint8_t pcg_unique_16_rxs_m_8_random_r(struct pcg_state_16* rng)
@@ -1866,6 +3898,37 @@ inline uint8_t pcg_unique_16_rxs_m_8_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint8_t pcg_unique_16_rxs_m_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                                       uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_unique_16_rxs_m_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_unique_16_rxs_m_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_unique_16_rxs_m_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                          const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_unique_16_rxs_m_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_unique_16_rxs_m_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_16_rxs_m_8_random_r(rng);
+}
+
 inline uint16_t pcg_unique_32_rxs_m_16_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -1884,6 +3947,38 @@ inline uint16_t pcg_unique_32_rxs_m_16_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint16_t
+pcg_unique_32_rxs_m_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                         uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_unique_32_rxs_m_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_unique_32_rxs_m_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_unique_32_rxs_m_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                           const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_unique_32_rxs_m_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_unique_32_rxs_m_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_32_rxs_m_16_random_r(rng);
+}
+
 inline uint32_t pcg_unique_64_rxs_m_32_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -1902,6 +3997,38 @@ inline uint32_t pcg_unique_64_rxs_m_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t
+pcg_unique_64_rxs_m_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                         uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_unique_64_rxs_m_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_unique_64_rxs_m_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_unique_64_rxs_m_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                           const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_unique_64_rxs_m_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_unique_64_rxs_m_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_64_rxs_m_32_random_r(rng);
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_unique_128_rxs_m_64_random_r(struct pcg_state_128* rng)
 {
@@ -1921,6 +4048,42 @@ inline uint64_t pcg_unique_128_rxs_m_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_unique_128_rxs_m_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                          uint64_t bound)
+{
+    uint64_t r = pcg_unique_128_rxs_m_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_unique_128_rxs_m_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_unique_128_rxs_m_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                            const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_unique_128_rxs_m_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_unique_128_rxs_m_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_128_rxs_m_64_random_r(rng);
+}
 #endif
 
 inline uint8_t pcg_setseq_16_rxs_m_8_random_r(struct pcg_state_setseq_16* rng)
@@ -1942,6 +4105,41 @@ pcg_setseq_16_rxs_m_8_boundedrand_r(struct pcg_state_setseq_16* rng,
     }
 }
 
+inline uint8_t
+pcg_setseq_16_rxs_m_8_boundedrand_mul_r(struct pcg_state_setseq_16* rng,
+                                        uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_setseq_16_rxs_m_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_setseq_16_rxs_m_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_setseq_16_rxs_m_8_boundedrand_fixed_r(struct pcg_state_setseq_16* rng,
+                                          const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_setseq_16_rxs_m_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_setseq_16_rxs_m_8_fill_r(struct pcg_state_setseq_16* rng, void* buf,
+                             size_t n)
+{
+    struct pcg_state_setseq_16 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_16_rxs_m_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t pcg_setseq_32_rxs_m_16_random_r(struct pcg_state_setseq_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -1961,6 +4159,41 @@ pcg_setseq_32_rxs_m_16_boundedrand_r(struct pcg_state_setseq_32* rng,
     }
 }
 
+inline uint16_t
+pcg_setseq_32_rxs_m_16_boundedrand_mul_r(struct pcg_state_setseq_32* rng,
+                                         uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_setseq_32_rxs_m_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_setseq_32_rxs_m_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_setseq_32_rxs_m_16_boundedrand_fixed_r(struct pcg_state_setseq_32* rng,
+                                           const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_setseq_32_rxs_m_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_setseq_32_rxs_m_16_fill_r(struct pcg_state_setseq_32* rng, void* buf,
+                              size_t n)
+{
+    struct pcg_state_setseq_32 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_32_rxs_m_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t pcg_setseq_64_rxs_m_32_random_r(struct pcg_state_setseq_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -1980,6 +4213,41 @@ pcg_setseq_64_rxs_m_32_boundedrand_r(struct pcg_state_setseq_64* rng,
     }
 }
 
+inline uint32_t
+pcg_setseq_64_rxs_m_32_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                         uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_setseq_64_rxs_m_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_setseq_64_rxs_m_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_setseq_64_rxs_m_32_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                           const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_setseq_64_rxs_m_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_setseq_64_rxs_m_32_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                              size_t n)
+{
+    struct pcg_state_setseq_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_64_rxs_m_32_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t
 pcg_setseq_128_rxs_m_64_random_r(struct pcg_state_setseq_128* rng)
@@ -2001,6 +4269,45 @@ pcg_setseq_128_rxs_m_64_boundedrand_r(struct pcg_state_setseq_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_setseq_128_rxs_m_64_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                          uint64_t bound)
+{
+    uint64_t r = pcg_setseq_128_rxs_m_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_setseq_128_rxs_m_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_setseq_128_rxs_m_64_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                            const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_setseq_128_rxs_m_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_setseq_128_rxs_m_64_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                               size_t n)
+{
+    struct pcg_state_setseq_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_128_rxs_m_64_random_r(&local);
+    *rng = local;
+}
 #endif
 
 inline uint8_t pcg_mcg_16_rxs_m_8_random_r(struct pcg_state_16* rng)
@@ -2021,6 +4328,39 @@ inline uint8_t pcg_mcg_16_rxs_m_8_boundedrand_r(struct pcg_state_16* rng,
     }
 }
 
+inline uint8_t pcg_mcg_16_rxs_m_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                                    uint8_t bound)
+{
+    uint16_t m = (uint16_t)pcg_mcg_16_rxs_m_8_random_r(rng) * bound;
+    if ((uint8_t)m < bound) {
+        uint8_t threshold = ((uint8_t)(-bound)) % bound;
+        while ((uint8_t)m < threshold)
+            m = (uint16_t)pcg_mcg_16_rxs_m_8_random_r(rng) * bound;
+    }
+    return m >> 8;
+}
+
+inline uint8_t
+pcg_mcg_16_rxs_m_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                       const struct pcg_bound_8* b)
+{
+    uint16_t m;
+    do {
+        m = (uint16_t)pcg_mcg_16_rxs_m_8_random_r(rng) * b->bound;
+    } while ((uint8_t)m < b->threshold);
+    return m >> 8;
+}
+
+inline void
+pcg_mcg_16_rxs_m_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n)
+{
+    struct pcg_state_16 local = *rng;
+    uint8_t* out = (uint8_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_16_rxs_m_8_random_r(&local);
+    *rng = local;
+}
+
 inline uint16_t pcg_mcg_32_rxs_m_16_random_r(struct pcg_state_32* rng)
 {
     uint32_t oldstate = rng->state;
@@ -2039,6 +4379,39 @@ inline uint16_t pcg_mcg_32_rxs_m_16_boundedrand_r(struct pcg_state_32* rng,
     }
 }
 
+inline uint16_t pcg_mcg_32_rxs_m_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                                      uint16_t bound)
+{
+    uint32_t m = (uint32_t)pcg_mcg_32_rxs_m_16_random_r(rng) * bound;
+    if ((uint16_t)m < bound) {
+        uint16_t threshold = ((uint16_t)(-bound)) % bound;
+        while ((uint16_t)m < threshold)
+            m = (uint32_t)pcg_mcg_32_rxs_m_16_random_r(rng) * bound;
+    }
+    return m >> 16;
+}
+
+inline uint16_t
+pcg_mcg_32_rxs_m_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                        const struct pcg_bound_16* b)
+{
+    uint32_t m;
+    do {
+        m = (uint32_t)pcg_mcg_32_rxs_m_16_random_r(rng) * b->bound;
+    } while ((uint16_t)m < b->threshold);
+    return m >> 16;
+}
+
+inline void
+pcg_mcg_32_rxs_m_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n)
+{
+    struct pcg_state_32 local = *rng;
+    uint16_t* out = (uint16_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_32_rxs_m_16_random_r(&local);
+    *rng = local;
+}
+
 inline uint32_t pcg_mcg_64_rxs_m_32_random_r(struct pcg_state_64* rng)
 {
     uint64_t oldstate = rng->state;
@@ -2057,6 +4430,39 @@ inline uint32_t pcg_mcg_64_rxs_m_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t pcg_mcg_64_rxs_m_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                                      uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_mcg_64_rxs_m_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_mcg_64_rxs_m_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_mcg_64_rxs_m_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                        const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_mcg_64_rxs_m_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_mcg_64_rxs_m_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    struct pcg_state_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_64_rxs_m_32_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_mcg_128_rxs_m_64_random_r(struct pcg_state_128* rng)
 {
@@ -2076,6 +4482,44 @@ inline uint64_t pcg_mcg_128_rxs_m_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_mcg_128_rxs_m_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                       uint64_t bound)
+{
+    uint64_t r = pcg_mcg_128_rxs_m_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_mcg_128_rxs_m_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_mcg_128_rxs_m_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                         const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_mcg_128_rxs_m_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_mcg_128_rxs_m_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    struct pcg_state_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_128_rxs_m_64_random_r(&local);
+    *rng = local;
+}
 #endif
 
 /* Generation functions for XSL RR (only defined for "large" types) */
@@ -2098,6 +4542,40 @@ inline uint32_t pcg_oneseq_64_xsl_rr_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t
+pcg_oneseq_64_xsl_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_oneseq_64_xsl_rr_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_oneseq_64_xsl_rr_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_oneseq_64_xsl_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_oneseq_64_xsl_rr_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_oneseq_64_xsl_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    struct pcg_state_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_64_xsl_rr_32_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_oneseq_128_xsl_rr_64_random_r(struct pcg_state_128* rng)
 {
@@ -2118,6 +4596,60 @@ pcg_oneseq_128_xsl_rr_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_oneseq_128_xsl_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound)
+{
+    uint64_t r = pcg_oneseq_128_xsl_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_oneseq_128_xsl_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_oneseq_128_xsl_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_oneseq_128_xsl_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_oneseq_128_xsl_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    struct pcg_state_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_128_xsl_rr_64_random_r(&local);
+    *rng = local;
+}
+
+inline void
+pcg_oneseq_128_xsl_rr_64_boundedrand_fill_r(struct pcg_state_128* rng,
+                                            uint64_t bound, uint64_t* out,
+                                            size_t n)
+{
+    uint64_t threshold = -bound % bound;
+    struct pcg_state_128 local = *rng;
+    size_t i = 0;
+    while (i < n) {
+        uint64_t lo, r = pcg_oneseq_128_xsl_rr_64_random_r(&local);
+        out[i] = pcg_mulhilo_64(r, bound, &lo);
+        i += lo >= threshold;
+    }
+    *rng = local;
+}
 #endif
 
 inline uint32_t pcg_unique_64_xsl_rr_32_random_r(struct pcg_state_64* rng)
@@ -2138,6 +4670,38 @@ inline uint32_t pcg_unique_64_xsl_rr_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t
+pcg_unique_64_xsl_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_unique_64_xsl_rr_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_unique_64_xsl_rr_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_unique_64_xsl_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_unique_64_xsl_rr_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_unique_64_xsl_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_64_xsl_rr_32_random_r(rng);
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_unique_128_xsl_rr_64_random_r(struct pcg_state_128* rng)
 {
@@ -2158,6 +4722,56 @@ pcg_unique_128_xsl_rr_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_unique_128_xsl_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound)
+{
+    uint64_t r = pcg_unique_128_xsl_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_unique_128_xsl_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_unique_128_xsl_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_unique_128_xsl_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_unique_128_xsl_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_128_xsl_rr_64_random_r(rng);
+}
+
+inline void
+pcg_unique_128_xsl_rr_64_boundedrand_fill_r(struct pcg_state_128* rng,
+                                            uint64_t bound, uint64_t* out,
+                                            size_t n)
+{
+    uint64_t threshold = -bound % bound;
+    size_t i = 0;
+    while (i < n) {
+        uint64_t lo, r = pcg_unique_128_xsl_rr_64_random_r(rng);
+        out[i] = pcg_mulhilo_64(r, bound, &lo);
+        i += lo >= threshold;
+    }
+}
 #endif
 
 inline uint32_t
@@ -2180,6 +4794,41 @@ pcg_setseq_64_xsl_rr_32_boundedrand_r(struct pcg_state_setseq_64* rng,
     }
 }
 
+inline uint32_t
+pcg_setseq_64_xsl_rr_32_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                          uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_setseq_64_xsl_rr_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_setseq_64_xsl_rr_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_setseq_64_xsl_rr_32_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                            const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_setseq_64_xsl_rr_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_setseq_64_xsl_rr_32_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                               size_t n)
+{
+    struct pcg_state_setseq_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_64_xsl_rr_32_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t
 pcg_setseq_128_xsl_rr_64_random_r(struct pcg_state_setseq_128* rng)
@@ -2201,6 +4850,61 @@ pcg_setseq_128_xsl_rr_64_boundedrand_r(struct pcg_state_setseq_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_setseq_128_xsl_rr_64_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                           uint64_t bound)
+{
+    uint64_t r = pcg_setseq_128_xsl_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_setseq_128_xsl_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_setseq_128_xsl_rr_64_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                             const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_setseq_128_xsl_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_setseq_128_xsl_rr_64_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                                size_t n)
+{
+    struct pcg_state_setseq_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_128_xsl_rr_64_random_r(&local);
+    *rng = local;
+}
+
+inline void
+pcg_setseq_128_xsl_rr_64_boundedrand_fill_r(struct pcg_state_setseq_128* rng,
+                                            uint64_t bound, uint64_t* out,
+                                            size_t n)
+{
+    uint64_t threshold = -bound % bound;
+    struct pcg_state_setseq_128 local = *rng;
+    size_t i = 0;
+    while (i < n) {
+        uint64_t lo, r = pcg_setseq_128_xsl_rr_64_random_r(&local);
+        out[i] = pcg_mulhilo_64(r, bound, &lo);
+        i += lo >= threshold;
+    }
+    *rng = local;
+}
 #endif
 
 inline uint32_t pcg_mcg_64_xsl_rr_32_random_r(struct pcg_state_64* rng)
@@ -2221,6 +4925,39 @@ inline uint32_t pcg_mcg_64_xsl_rr_32_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint32_t pcg_mcg_64_xsl_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                                       uint32_t bound)
+{
+    uint64_t m = (uint64_t)pcg_mcg_64_xsl_rr_32_random_r(rng) * bound;
+    if ((uint32_t)m < bound) {
+        uint32_t threshold = -bound % bound;
+        while ((uint32_t)m < threshold)
+            m = (uint64_t)pcg_mcg_64_xsl_rr_32_random_r(rng) * bound;
+    }
+    return m >> 32;
+}
+
+inline uint32_t
+pcg_mcg_64_xsl_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                         const struct pcg_bound_32* b)
+{
+    uint64_t m;
+    do {
+        m = (uint64_t)pcg_mcg_64_xsl_rr_32_random_r(rng) * b->bound;
+    } while ((uint32_t)m < b->threshold);
+    return m >> 32;
+}
+
+inline void
+pcg_mcg_64_xsl_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    struct pcg_state_64 local = *rng;
+    uint32_t* out = (uint32_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_64_xsl_rr_32_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline uint64_t pcg_mcg_128_xsl_rr_64_random_r(struct pcg_state_128* rng)
 {
@@ -2240,6 +4977,60 @@ inline uint64_t pcg_mcg_128_xsl_rr_64_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline uint64_t
+pcg_mcg_128_xsl_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                        uint64_t bound)
+{
+    uint64_t r = pcg_mcg_128_xsl_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_mcg_128_xsl_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_mcg_128_xsl_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                          const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_mcg_128_xsl_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_mcg_128_xsl_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n)
+{
+    struct pcg_state_128 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_mcg_128_xsl_rr_64_random_r(&local);
+    *rng = local;
+}
+
+inline void
+pcg_mcg_128_xsl_rr_64_boundedrand_fill_r(struct pcg_state_128* rng,
+                                         uint64_t bound, uint64_t* out,
+                                         size_t n)
+{
+    uint64_t threshold = -bound % bound;
+    struct pcg_state_128 local = *rng;
+    size_t i = 0;
+    while (i < n) {
+        uint64_t lo, r = pcg_mcg_128_xsl_rr_64_random_r(&local);
+        out[i] = pcg_mulhilo_64(r, bound, &lo);
+        i += lo >= threshold;
+    }
+    *rng = local;
+}
 #endif
 
 /* Generation functions for XSL RR RR (only defined for "large" types) */
@@ -2263,6 +5054,44 @@ pcg_oneseq_64_xsl_rr_rr_64_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint64_t
+pcg_oneseq_64_xsl_rr_rr_64_boundedrand_mul_r(struct pcg_state_64* rng,
+                                             uint64_t bound)
+{
+    uint64_t r = pcg_oneseq_64_xsl_rr_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_oneseq_64_xsl_rr_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_oneseq_64_xsl_rr_rr_64_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                               const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_oneseq_64_xsl_rr_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_oneseq_64_xsl_rr_rr_64_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    struct pcg_state_64 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_64_xsl_rr_rr_64_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline pcg128_t pcg_oneseq_128_xsl_rr_rr_128_random_r(struct pcg_state_128* rng)
 {
@@ -2283,6 +5112,45 @@ pcg_oneseq_128_xsl_rr_rr_128_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline pcg128_t
+pcg_oneseq_128_xsl_rr_rr_128_boundedrand_mul_r(struct pcg_state_128* rng,
+                                               pcg128_t bound)
+{
+    pcg128_t r = pcg_oneseq_128_xsl_rr_rr_128_random_r(rng);
+    pcg128_t lo, hi = pcg_mulhilo_128(r, bound, &lo);
+    if (lo < bound) {
+        pcg128_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_oneseq_128_xsl_rr_rr_128_random_r(rng);
+            hi = pcg_mulhilo_128(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline pcg128_t
+pcg_oneseq_128_xsl_rr_rr_128_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                                 const struct pcg_bound_128* b)
+{
+    pcg128_t r, lo, hi;
+    do {
+        r = pcg_oneseq_128_xsl_rr_rr_128_random_r(rng);
+        hi = pcg_mulhilo_128(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_oneseq_128_xsl_rr_rr_128_fill_r(struct pcg_state_128* rng, void* buf,
+                                    size_t n)
+{
+    struct pcg_state_128 local = *rng;
+    pcg128_t* out = (pcg128_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_oneseq_128_xsl_rr_rr_128_random_r(&local);
+    *rng = local;
+}
 #endif
 
 inline uint64_t pcg_unique_64_xsl_rr_rr_64_random_r(struct pcg_state_64* rng)
@@ -2304,6 +5172,42 @@ pcg_unique_64_xsl_rr_rr_64_boundedrand_r(struct pcg_state_64* rng,
     }
 }
 
+inline uint64_t
+pcg_unique_64_xsl_rr_rr_64_boundedrand_mul_r(struct pcg_state_64* rng,
+                                             uint64_t bound)
+{
+    uint64_t r = pcg_unique_64_xsl_rr_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_unique_64_xsl_rr_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_unique_64_xsl_rr_rr_64_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                               const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_unique_64_xsl_rr_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_unique_64_xsl_rr_rr_64_fill_r(struct pcg_state_64* rng, void* buf, size_t n)
+{
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_64_xsl_rr_rr_64_random_r(rng);
+}
+
 #if PCG_HAS_128BIT_OPS
 inline pcg128_t pcg_unique_128_xsl_rr_rr_128_random_r(struct pcg_state_128* rng)
 {
@@ -2324,6 +5228,43 @@ pcg_unique_128_xsl_rr_rr_128_boundedrand_r(struct pcg_state_128* rng,
             return r % bound;
     }
 }
+
+inline pcg128_t
+pcg_unique_128_xsl_rr_rr_128_boundedrand_mul_r(struct pcg_state_128* rng,
+                                               pcg128_t bound)
+{
+    pcg128_t r = pcg_unique_128_xsl_rr_rr_128_random_r(rng);
+    pcg128_t lo, hi = pcg_mulhilo_128(r, bound, &lo);
+    if (lo < bound) {
+        pcg128_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_unique_128_xsl_rr_rr_128_random_r(rng);
+            hi = pcg_mulhilo_128(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline pcg128_t
+pcg_unique_128_xsl_rr_rr_128_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                                 const struct pcg_bound_128* b)
+{
+    pcg128_t r, lo, hi;
+    do {
+        r = pcg_unique_128_xsl_rr_rr_128_random_r(rng);
+        hi = pcg_mulhilo_128(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_unique_128_xsl_rr_rr_128_fill_r(struct pcg_state_128* rng, void* buf,
+                                    size_t n)
+{
+    pcg128_t* out = (pcg128_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_unique_128_xsl_rr_rr_128_random_r(rng);
+}
 #endif
 
 inline uint64_t
@@ -2346,6 +5287,45 @@ pcg_setseq_64_xsl_rr_rr_64_boundedrand_r(struct pcg_state_setseq_64* rng,
     }
 }
 
+inline uint64_t
+pcg_setseq_64_xsl_rr_rr_64_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                             uint64_t bound)
+{
+    uint64_t r = pcg_setseq_64_xsl_rr_rr_64_random_r(rng);
+    uint64_t lo, hi = pcg_mulhilo_64(r, bound, &lo);
+    if (lo < bound) {
+        uint64_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_setseq_64_xsl_rr_rr_64_random_r(rng);
+            hi = pcg_mulhilo_64(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline uint64_t
+pcg_setseq_64_xsl_rr_rr_64_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                               const struct pcg_bound_64* b)
+{
+    uint64_t r, lo, hi;
+    do {
+        r = pcg_setseq_64_xsl_rr_rr_64_random_r(rng);
+        hi = pcg_mulhilo_64(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_setseq_64_xsl_rr_rr_64_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                                  size_t n)
+{
+    struct pcg_state_setseq_64 local = *rng;
+    uint64_t* out = (uint64_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_64_xsl_rr_rr_64_random_r(&local);
+    *rng = local;
+}
+
 #if PCG_HAS_128BIT_OPS
 inline pcg128_t
 pcg_setseq_128_xsl_rr_rr_128_random_r(struct pcg_state_setseq_128* rng)
@@ -2367,6 +5347,45 @@ pcg_setseq_128_xsl_rr_rr_128_boundedrand_r(struct pcg_state_setseq_128* rng,
             return r % bound;
     }
 }
+
+inline pcg128_t
+pcg_setseq_128_xsl_rr_rr_128_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                               pcg128_t bound)
+{
+    pcg128_t r = pcg_setseq_128_xsl_rr_rr_128_random_r(rng);
+    pcg128_t lo, hi = pcg_mulhilo_128(r, bound, &lo);
+    if (lo < bound) {
+        pcg128_t threshold = -bound % bound;
+        while (lo < threshold) {
+            r = pcg_setseq_128_xsl_rr_rr_128_random_r(rng);
+            hi = pcg_mulhilo_128(r, bound, &lo);
+        }
+    }
+    return hi;
+}
+
+inline pcg128_t
+pcg_setseq_128_xsl_rr_rr_128_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                                 const struct pcg_bound_128* b)
+{
+    pcg128_t r, lo, hi;
+    do {
+        r = pcg_setseq_128_xsl_rr_rr_128_random_r(rng);
+        hi = pcg_mulhilo_128(r, b->bound, &lo);
+    } while (lo < b->threshold);
+    return hi;
+}
+
+inline void
+pcg_setseq_128_xsl_rr_rr_128_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                                    size_t n)
+{
+    struct pcg_state_setseq_128 local = *rng;
+    pcg128_t* out = (pcg128_t*) buf;
+    for (size_t i = 0; i < n; ++i)
+        out[i] = pcg_setseq_128_xsl_rr_rr_128_random_r(&local);
+    *rng = local;
+}
 #endif
 
 /*** Typedefs */
@@ -2384,6 +5403,26 @@ typedef struct pcg_state_64             pcg32f_random_t;
 #define pcg32s_boundedrand_r            pcg_oneseq_64_xsh_rr_32_boundedrand_r
 #define pcg32u_boundedrand_r            pcg_unique_64_xsh_rr_32_boundedrand_r
 #define pcg32f_boundedrand_r            pcg_mcg_64_xsh_rs_32_boundedrand_r
+/*** boundedrand_mul_r */
+#define pcg32_boundedrand_mul_r         pcg_setseq_64_xsh_rr_32_boundedrand_mul_r
+#define pcg32s_boundedrand_mul_r        pcg_oneseq_64_xsh_rr_32_boundedrand_mul_r
+#define pcg32u_boundedrand_mul_r        pcg_unique_64_xsh_rr_32_boundedrand_mul_r
+#define pcg32f_boundedrand_mul_r        pcg_mcg_64_xsh_rs_32_boundedrand_mul_r
+/*** boundedrand_fixed_r */
+#define pcg32_boundedrand_fixed_r       pcg_setseq_64_xsh_rr_32_boundedrand_fixed_r
+#define pcg32s_boundedrand_fixed_r      pcg_oneseq_64_xsh_rr_32_boundedrand_fixed_r
+#define pcg32u_boundedrand_fixed_r      pcg_unique_64_xsh_rr_32_boundedrand_fixed_r
+#define pcg32f_boundedrand_fixed_r      pcg_mcg_64_xsh_rs_32_boundedrand_fixed_r
+/*** fill_r */
+#define pcg32_fill_r                    pcg_setseq_64_xsh_rr_32_fill_r
+#define pcg32s_fill_r                   pcg_oneseq_64_xsh_rr_32_fill_r
+#define pcg32u_fill_r                   pcg_unique_64_xsh_rr_32_fill_r
+#define pcg32f_fill_r                   pcg_mcg_64_xsh_rs_32_fill_r
+/*** boundedrand_fill_r */
+#define pcg32_boundedrand_fill_r        pcg_setseq_64_xsh_rr_32_boundedrand_fill_r
+#define pcg32s_boundedrand_fill_r       pcg_oneseq_64_xsh_rr_32_boundedrand_fill_r
+#define pcg32u_boundedrand_fill_r       pcg_unique_64_xsh_rr_32_boundedrand_fill_r
+#define pcg32f_boundedrand_fill_r       pcg_mcg_64_xsh_rs_32_boundedrand_fill_r
 /*** srandom_r */
 #define pcg32_srandom_r                 pcg_setseq_64_srandom_r
 #define pcg32s_srandom_r                pcg_oneseq_64_srandom_r
@@ -2391,6 +5430,10 @@ typedef struct pcg_state_64             pcg32f_random_t;
 #define pcg32f_srandom_r                pcg_mcg_64_srandom_r
 /*** advance_r */
 #define pcg32_advance_r                 pcg_setseq_64_advance_r
+typedef struct pcg_partition_setseq_64  pcg32_partition_t;
+#define pcg32_partition_r               pcg_setseq_64_partition_r
+#define pcg32_partition_block_r         pcg_setseq_64_partition_block_r
+#define pcg32_partition_fill_r          pcg_setseq_64_partition_fill_r
 #define pcg32s_advance_r                pcg_oneseq_64_advance_r
 #define pcg32u_advance_r                pcg_unique_64_advance_r
 #define pcg32f_advance_r                pcg_mcg_64_advance_r
@@ -2411,6 +5454,26 @@ typedef struct pcg_state_128            pcg64f_random_t;
 #define pcg64s_boundedrand_r            pcg_oneseq_128_xsl_rr_64_boundedrand_r
 #define pcg64u_boundedrand_r            pcg_unique_128_xsl_rr_64_boundedrand_r
 #define pcg64f_boundedrand_r            pcg_mcg_128_xsl_rr_64_boundedrand_r
+/*** boundedrand_mul_r */
+#define pcg64_boundedrand_mul_r         pcg_setseq_128_xsl_rr_64_boundedrand_mul_r
+#define pcg64s_boundedrand_mul_r        pcg_oneseq_128_xsl_rr_64_boundedrand_mul_r
+#define pcg64u_boundedrand_mul_r        pcg_unique_128_xsl_rr_64_boundedrand_mul_r
+#define pcg64f_boundedrand_mul_r        pcg_mcg_128_xsl_rr_64_boundedrand_mul_r
+/*** boundedrand_fixed_r */
+#define pcg64_boundedrand_fixed_r       pcg_setseq_128_xsl_rr_64_boundedrand_fixed_r
+#define pcg64s_boundedrand_fixed_r      pcg_oneseq_128_xsl_rr_64_boundedrand_fixed_r
+#define pcg64u_boundedrand_fixed_r      pcg_unique_128_xsl_rr_64_boundedrand_fixed_r
+#define pcg64f_boundedrand_fixed_r      pcg_mcg_128_xsl_rr_64_boundedrand_fixed_r
+/*** fill_r */
+#define pcg64_fill_r                    pcg_setseq_128_xsl_rr_64_fill_r
+#define pcg64s_fill_r                   pcg_oneseq_128_xsl_rr_64_fill_r
+#define pcg64u_fill_r                   pcg_unique_128_xsl_rr_64_fill_r
+#define pcg64f_fill_r                   pcg_mcg_128_xsl_rr_64_fill_r
+/*** boundedrand_fill_r */
+#define pcg64_boundedrand_fill_r        pcg_setseq_128_xsl_rr_64_boundedrand_fill_r
+#define pcg64s_boundedrand_fill_r       pcg_oneseq_128_xsl_rr_64_boundedrand_fill_r
+#define pcg64u_boundedrand_fill_r       pcg_unique_128_xsl_rr_64_boundedrand_fill_r
+#define pcg64f_boundedrand_fill_r       pcg_mcg_128_xsl_rr_64_boundedrand_fill_r
 /*** srandom_r */
 #define pcg64_srandom_r                 pcg_setseq_128_srandom_r
 #define pcg64s_srandom_r                pcg_oneseq_128_srandom_r
@@ -2418,6 +5481,10 @@ typedef struct pcg_state_128            pcg64f_random_t;
 #define pcg64f_srandom_r                pcg_mcg_128_srandom_r
 /*** advance_r */
 #define pcg64_advance_r                 pcg_setseq_128_advance_r
+typedef struct pcg_partition_setseq_128 pcg64_partition_t;
+#define pcg64_partition_r               pcg_setseq_128_partition_r
+#define pcg64_partition_block_r         pcg_setseq_128_partition_block_r
+#define pcg64_partition_fill_r          pcg_setseq_128_partition_fill_r
 #define pcg64s_advance_r                pcg_oneseq_128_advance_r
 #define pcg64u_advance_r                pcg_unique_128_advance_r
 #define pcg64f_advance_r                pcg_mcg_128_advance_r
@@ -2438,6 +5505,21 @@ typedef struct pcg_state_64             pcg64si_random_t;
 #define pcg16si_boundedrand_r           pcg_oneseq_16_rxs_m_xs_16_boundedrand_r
 #define pcg32si_boundedrand_r           pcg_oneseq_32_rxs_m_xs_32_boundedrand_r
 #define pcg64si_boundedrand_r           pcg_oneseq_64_rxs_m_xs_64_boundedrand_r
+/*** boundedrand_mul_r */
+#define pcg8si_boundedrand_mul_r        pcg_oneseq_8_rxs_m_xs_8_boundedrand_mul_r
+#define pcg16si_boundedrand_mul_r       pcg_oneseq_16_rxs_m_xs_16_boundedrand_mul_r
+#define pcg32si_boundedrand_mul_r       pcg_oneseq_32_rxs_m_xs_32_boundedrand_mul_r
+#define pcg64si_boundedrand_mul_r       pcg_oneseq_64_rxs_m_xs_64_boundedrand_mul_r
+/*** boundedrand_fixed_r */
+#define pcg8si_boundedrand_fixed_r      pcg_oneseq_8_rxs_m_xs_8_boundedrand_fixed_r
+#define pcg16si_boundedrand_fixed_r     pcg_oneseq_16_rxs_m_xs_16_boundedrand_fixed_r
+#define pcg32si_boundedrand_fixed_r     pcg_oneseq_32_rxs_m_xs_32_boundedrand_fixed_r
+#define pcg64si_boundedrand_fixed_r     pcg_oneseq_64_rxs_m_xs_64_boundedrand_fixed_r
+/*** fill_r */
+#define pcg8si_fill_r                   pcg_oneseq_8_rxs_m_xs_8_fill_r
+#define pcg16si_fill_r                  pcg_oneseq_16_rxs_m_xs_16_fill_r
+#define pcg32si_fill_r                  pcg_oneseq_32_rxs_m_xs_32_fill_r
+#define pcg64si_fill_r                  pcg_oneseq_64_rxs_m_xs_64_fill_r
 /*** srandom_r */
 #define pcg8si_srandom_r                pcg_oneseq_8_srandom_r
 #define pcg16si_srandom_r               pcg_oneseq_16_srandom_r
@@ -2453,6 +5535,9 @@ typedef struct pcg_state_64             pcg64si_random_t;
 typedef struct pcg_state_128        pcg128si_random_t;
 #define pcg128si_random_r           pcg_oneseq_128_rxs_m_xs_128_random_r
 #define pcg128si_boundedrand_r      pcg_oneseq_128_rxs_m_xs_128_boundedrand_r
+#define pcg128si_boundedrand_mul_r  pcg_oneseq_128_rxs_m_xs_128_boundedrand_mul_r
+#define pcg128si_boundedrand_fixed_r pcg_oneseq_128_rxs_m_xs_128_boundedrand_fixed_r
+#define pcg128si_fill_r             pcg_oneseq_128_rxs_m_xs_128_fill_r
 #define pcg128si_srandom_r          pcg_oneseq_128_srandom_r
 #define pcg128si_advance_r          pcg_oneseq_128_advance_r
 #endif
@@ -2472,6 +5557,21 @@ typedef struct pcg_state_setseq_64      pcg64i_random_t;
 #define pcg16i_boundedrand_r            pcg_setseq_16_rxs_m_xs_16_boundedrand_r
 #define pcg32i_boundedrand_r            pcg_setseq_32_rxs_m_xs_32_boundedrand_r
 #define pcg64i_boundedrand_r            pcg_setseq_64_rxs_m_xs_64_boundedrand_r
+/*** boundedrand_mul_r */
+#define pcg8i_boundedrand_mul_r         pcg_setseq_8_rxs_m_xs_8_boundedrand_mul_r
+#define pcg16i_boundedrand_mul_r        pcg_setseq_16_rxs_m_xs_16_boundedrand_mul_r
+#define pcg32i_boundedrand_mul_r        pcg_setseq_32_rxs_m_xs_32_boundedrand_mul_r
+#define pcg64i_boundedrand_mul_r        pcg_setseq_64_rxs_m_xs_64_boundedrand_mul_r
+/*** boundedrand_fixed_r */
+#define pcg8i_boundedrand_fixed_r       pcg_setseq_8_rxs_m_xs_8_boundedrand_fixed_r
+#define pcg16i_boundedrand_fixed_r      pcg_setseq_16_rxs_m_xs_16_boundedrand_fixed_r
+#define pcg32i_boundedrand_fixed_r      pcg_setseq_32_rxs_m_xs_32_boundedrand_fixed_r
+#define pcg64i_boundedrand_fixed_r      pcg_setseq_64_rxs_m_xs_64_boundedrand_fixed_r
+/*** fill_r */
+#define pcg8i_fill_r                    pcg_setseq_8_rxs_m_xs_8_fill_r
+#define pcg16i_fill_r                   pcg_setseq_16_rxs_m_xs_16_fill_r
+#define pcg32i_fill_r                   pcg_setseq_32_rxs_m_xs_32_fill_r
+#define pcg64i_fill_r                   pcg_setseq_64_rxs_m_xs_64_fill_r
 /*** srandom_r */
 #define pcg8i_srandom_r                 pcg_setseq_8_srandom_r
 #define pcg16i_srandom_r                pcg_setseq_16_srandom_r
@@ -2487,6 +5587,9 @@ typedef struct pcg_state_setseq_64      pcg64i_random_t;
 typedef struct pcg_state_setseq_128   pcg128i_random_t;
 #define pcg128i_random_r              pcg_setseq_128_rxs_m_xs_128_random_r
 #define pcg128i_boundedrand_r         pcg_setseq_128_rxs_m_xs_128_boundedrand_r
+#define pcg128i_boundedrand_mul_r     pcg_setseq_128_rxs_m_xs_128_boundedrand_mul_r
+#define pcg128i_boundedrand_fixed_r   pcg_setseq_128_rxs_m_xs_128_boundedrand_fixed_r
+#define pcg128i_fill_r                pcg_setseq_128_rxs_m_xs_128_fill_r
 #define pcg128i_srandom_r             pcg_setseq_128_srandom_r
 #define pcg128i_advance_r             pcg_setseq_128_advance_r
 #endif
@@ -2503,6 +5606,27 @@ extern void     pcg64_srandom(pcg128_t seed, pcg128_t seq);
 extern void     pcg64_advance(pcg128_t delta);
 #endif
 
+/*
+ * Per-thread global RNGs.  Each thread has its own generator, seeded on
+ * first use with a stream selector no other thread has been given, so
+ * threads never wait on each other or share a cache line.  The _tl
+ * srandom and advance functions affect the calling thread only.
+ */
+
+#if PCG_HAS_THREAD_LOCAL
+extern uint32_t pcg32_random_tl(void);
+extern uint32_t pcg32_boundedrand_tl(uint32_t bound);
+extern void     pcg32_srandom_tl(uint64_t seed, uint64_t seq);
+extern void     pcg32_advance_tl(uint64_t delta);
+
+#if PCG_HAS_128BIT_OPS
+extern uint64_t pcg64_random_tl(void);
+extern uint64_t pcg64_boundedrand_tl(uint64_t bound);
+extern void     pcg64_srandom_tl(pcg128_t seed, pcg128_t seq);
+extern void     pcg64_advance_tl(pcg128_t delta);
+#endif
+#endif
+
 /*
  * Static initialization constants (if you can't call srandom for some
  * bizarre reason).
@@ -52,3 +52,49 @@ void pcg32_advance(uint64_t delta)
     return pcg32_advance_r(&pcg32_global, delta);
 }
 
+
+#if PCG_HAS_THREAD_LOCAL
+
+static PCG_THREAD_LOCAL pcg32_random_t pcg32_thread;
+
+#if __GNUC__ || __clang__
+static uint64_t pcg32_thread_streams;
+#define PCG32_NEXT_STREAM()                                                    \
+    __atomic_fetch_add(&pcg32_thread_streams, 1, __ATOMIC_RELAXED)
+#else
+#include <stdatomic.h>
+static atomic_uint_least64_t pcg32_thread_streams;
+#define PCG32_NEXT_STREAM()                                                    \
+    atomic_fetch_add_explicit(&pcg32_thread_streams, 1, memory_order_relaxed)
+#endif
+
+/* srandom always makes the increment odd, so zero means not seeded yet */
+static pcg32_random_t* pcg32_thread_rng(void)
+{
+    if (pcg32_thread.inc == 0)
+        pcg32_srandom_r(&pcg32_thread, 0x853c49e6748fea9bULL,
+                        PCG32_NEXT_STREAM());
+    return &pcg32_thread;
+}
+
+uint32_t pcg32_random_tl(void)
+{
+    return pcg32_random_r(pcg32_thread_rng());
+}
+
+uint32_t pcg32_boundedrand_tl(uint32_t bound)
+{
+    return pcg32_boundedrand_r(pcg32_thread_rng(), bound);
+}
+
+void pcg32_srandom_tl(uint64_t seed, uint64_t seq)
+{
+    pcg32_srandom_r(&pcg32_thread, seed, seq);
+}
+
+void pcg32_advance_tl(uint64_t delta)
+{
+    pcg32_advance_r(pcg32_thread_rng(), delta);
+}
+
+#endif
@@ -54,4 +54,52 @@ void pcg64_advance(pcg128_t delta)
     pcg64_advance_r(&pcg64_global, delta);
 }
 
+#if PCG_HAS_THREAD_LOCAL
+
+static PCG_THREAD_LOCAL pcg64_random_t pcg64_thread;
+
+#if __GNUC__ || __clang__
+static uint64_t pcg64_thread_streams;
+#define PCG64_NEXT_STREAM()                                                    \
+    __atomic_fetch_add(&pcg64_thread_streams, 1, __ATOMIC_RELAXED)
+#else
+#include <stdatomic.h>
+static atomic_uint_least64_t pcg64_thread_streams;
+#define PCG64_NEXT_STREAM()                                                    \
+    atomic_fetch_add_explicit(&pcg64_thread_streams, 1, memory_order_relaxed)
+#endif
+
+/* srandom always makes the increment odd, so zero means not seeded yet */
+static pcg64_random_t* pcg64_thread_rng(void)
+{
+    if (pcg64_thread.inc == 0)
+        pcg64_srandom_r(&pcg64_thread,
+                        PCG_128BIT_CONSTANT(0x979c9a98d8462005ULL,
+                                            0x7d3e9cb6cfe0549bULL),
+                        PCG64_NEXT_STREAM());
+    return &pcg64_thread;
+}
+
+uint64_t pcg64_random_tl(void)
+{
+    return pcg64_random_r(pcg64_thread_rng());
+}
+
+uint64_t pcg64_boundedrand_tl(uint64_t bound)
+{
+    return pcg64_boundedrand_r(pcg64_thread_rng(), bound);
+}
+
+void pcg64_srandom_tl(pcg128_t seed, pcg128_t seq)
+{
+    pcg64_srandom_r(&pcg64_thread, seed, seq);
+}
+
+void pcg64_advance_tl(pcg128_t delta)
+{
+    pcg64_advance_r(pcg64_thread_rng(), delta);
+}
+
+#endif
+
 #endif
@@ -38,6 +38,17 @@
 extern inline pcg128_t pcg_rotr_128(pcg128_t value, unsigned int rot);
 #endif
 
+/*
+ * Bounded generation helpers.
+ */
+
+#if PCG_HAS_128BIT_OPS
+extern inline pcg128_t pcg_mulhilo_128(pcg128_t a, pcg128_t b, pcg128_t* lo);
+
+extern inline void pcg_bound_128_init(struct pcg_bound_128* b,
+                                      pcg128_t bound);
+#endif
+
 /*
  * Output functions.  These are the core of the PCG generation scheme.
  */
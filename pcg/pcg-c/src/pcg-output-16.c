@@ -36,6 +36,12 @@
 
 extern inline uint16_t pcg_rotr_16(uint16_t value, unsigned int rot);
 
+/*
+ * Bounded generation helpers.
+ */
+
+extern inline void pcg_bound_16_init(struct pcg_bound_16* b, uint16_t bound);
+
 /*
  * Output functions.  These are the core of the PCG generation scheme.
  */
@@ -36,6 +36,12 @@
 
 extern inline uint32_t pcg_rotr_32(uint32_t value, unsigned int rot);
 
+/*
+ * Bounded generation helpers.
+ */
+
+extern inline void pcg_bound_32_init(struct pcg_bound_32* b, uint32_t bound);
+
 /*
  * Output functions.  These are the core of the PCG generation scheme.
  */
@@ -36,6 +36,14 @@
 
 extern inline uint64_t pcg_rotr_64(uint64_t value, unsigned int rot);
 
+/*
+ * Bounded generation helpers.
+ */
+
+extern inline uint64_t pcg_mulhilo_64(uint64_t a, uint64_t b, uint64_t* lo);
+
+extern inline void pcg_bound_64_init(struct pcg_bound_64* b, uint64_t bound);
+
 /*
  * Output functions.  These are the core of the PCG generation scheme.
  */
@@ -36,6 +36,12 @@
 
 extern inline uint8_t pcg_rotr_8(uint8_t value, unsigned int rot);
 
+/*
+ * Bounded generation helpers.
+ */
+
+extern inline void pcg_bound_8_init(struct pcg_bound_8* b, uint8_t bound);
+
 /*
  * Output functions.  These are the core of the PCG generation scheme.
  */
@@ -71,6 +71,26 @@ extern inline void pcg_setseq_128_advance_r(struct pcg_state_setseq_128* rng,
                                             pcg128_t delta);
 #endif
 
+#if PCG_HAS_128BIT_OPS
+extern inline void
+pcg_setseq_128_partition_r(struct pcg_partition_setseq_128* part,
+                           const struct pcg_state_setseq_128* rng,
+                           pcg128_t blocksize);
+#endif
+
+#if PCG_HAS_128BIT_OPS
+extern inline void
+pcg_setseq_128_partition_block_r(const struct pcg_partition_setseq_128* part,
+                                 pcg128_t k, struct pcg_state_setseq_128* rng);
+#endif
+
+#if PCG_HAS_128BIT_OPS
+extern inline void
+pcg_setseq_128_partition_fill_r(const struct pcg_partition_setseq_128* part,
+                                pcg128_t first,
+                                struct pcg_state_setseq_128* rngs, size_t n);
+#endif
+
 /* Functions to seed the RNG state, one version for each size and each
  * style.  Unlike the step functions, regular users can and should call
  * these functions.
@@ -137,6 +157,17 @@ pcg_oneseq_128_xsh_rs_64_random_r(struct pcg_state_128* rng);
 extern inline uint64_t
 pcg_oneseq_128_xsh_rs_64_boundedrand_r(struct pcg_state_128* rng,
                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_oneseq_128_xsh_rs_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound);
+
+extern inline uint64_t
+pcg_oneseq_128_xsh_rs_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b);
+
+extern inline void
+pcg_oneseq_128_xsh_rs_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -148,6 +179,17 @@ pcg_unique_128_xsh_rs_64_random_r(struct pcg_state_128* rng);
 extern inline uint64_t
 pcg_unique_128_xsh_rs_64_boundedrand_r(struct pcg_state_128* rng,
                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_unique_128_xsh_rs_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound);
+
+extern inline uint64_t
+pcg_unique_128_xsh_rs_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b);
+
+extern inline void
+pcg_unique_128_xsh_rs_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -159,6 +201,18 @@ pcg_setseq_128_xsh_rs_64_random_r(struct pcg_state_setseq_128* rng);
 extern inline uint64_t
 pcg_setseq_128_xsh_rs_64_boundedrand_r(struct pcg_state_setseq_128* rng,
                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_setseq_128_xsh_rs_64_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                           uint64_t bound);
+
+extern inline uint64_t
+pcg_setseq_128_xsh_rs_64_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                             const struct pcg_bound_64* b);
+
+extern inline void
+pcg_setseq_128_xsh_rs_64_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                                size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -169,6 +223,17 @@ pcg_mcg_128_xsh_rs_64_random_r(struct pcg_state_128* rng);
 #if PCG_HAS_128BIT_OPS
 extern inline uint64_t
 pcg_mcg_128_xsh_rs_64_boundedrand_r(struct pcg_state_128* rng, uint64_t bound);
+
+extern inline uint64_t
+pcg_mcg_128_xsh_rs_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_mcg_128_xsh_rs_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                          const struct pcg_bound_64* b);
+
+extern inline void
+pcg_mcg_128_xsh_rs_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
 #endif
 
 /* Generation functions for XSH RR */
@@ -182,6 +247,17 @@ pcg_oneseq_128_xsh_rr_64_random_r(struct pcg_state_128* rng);
 extern inline uint64_t
 pcg_oneseq_128_xsh_rr_64_boundedrand_r(struct pcg_state_128* rng,
                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_oneseq_128_xsh_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound);
+
+extern inline uint64_t
+pcg_oneseq_128_xsh_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b);
+
+extern inline void
+pcg_oneseq_128_xsh_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -193,6 +269,17 @@ pcg_unique_128_xsh_rr_64_random_r(struct pcg_state_128* rng);
 extern inline uint64_t
 pcg_unique_128_xsh_rr_64_boundedrand_r(struct pcg_state_128* rng,
                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_unique_128_xsh_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound);
+
+extern inline uint64_t
+pcg_unique_128_xsh_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b);
+
+extern inline void
+pcg_unique_128_xsh_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -204,6 +291,18 @@ pcg_setseq_128_xsh_rr_64_random_r(struct pcg_state_setseq_128* rng);
 extern inline uint64_t
 pcg_setseq_128_xsh_rr_64_boundedrand_r(struct pcg_state_setseq_128* rng,
                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_setseq_128_xsh_rr_64_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                           uint64_t bound);
+
+extern inline uint64_t
+pcg_setseq_128_xsh_rr_64_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                             const struct pcg_bound_64* b);
+
+extern inline void
+pcg_setseq_128_xsh_rr_64_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                                size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -214,6 +313,17 @@ pcg_mcg_128_xsh_rr_64_random_r(struct pcg_state_128* rng);
 #if PCG_HAS_128BIT_OPS
 extern inline uint64_t
 pcg_mcg_128_xsh_rr_64_boundedrand_r(struct pcg_state_128* rng, uint64_t bound);
+
+extern inline uint64_t
+pcg_mcg_128_xsh_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_mcg_128_xsh_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                          const struct pcg_bound_64* b);
+
+extern inline void
+pcg_mcg_128_xsh_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
 #endif
 
 /* Generation functions for RXS M XS (no MCG versions because they
@@ -229,6 +339,18 @@ pcg_oneseq_128_rxs_m_xs_128_random_r(struct pcg_state_128* rng);
 extern inline pcg128_t
 pcg_oneseq_128_rxs_m_xs_128_boundedrand_r(struct pcg_state_128* rng,
                                           pcg128_t bound);
+
+extern inline pcg128_t
+pcg_oneseq_128_rxs_m_xs_128_boundedrand_mul_r(struct pcg_state_128* rng,
+                                              pcg128_t bound);
+
+extern inline pcg128_t
+pcg_oneseq_128_rxs_m_xs_128_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                                const struct pcg_bound_128* b);
+
+extern inline void
+pcg_oneseq_128_rxs_m_xs_128_fill_r(struct pcg_state_128* rng, void* buf,
+                                   size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -240,6 +362,18 @@ pcg_unique_128_rxs_m_xs_128_random_r(struct pcg_state_128* rng);
 extern inline pcg128_t
 pcg_unique_128_rxs_m_xs_128_boundedrand_r(struct pcg_state_128* rng,
                                           pcg128_t bound);
+
+extern inline pcg128_t
+pcg_unique_128_rxs_m_xs_128_boundedrand_mul_r(struct pcg_state_128* rng,
+                                              pcg128_t bound);
+
+extern inline pcg128_t
+pcg_unique_128_rxs_m_xs_128_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                                const struct pcg_bound_128* b);
+
+extern inline void
+pcg_unique_128_rxs_m_xs_128_fill_r(struct pcg_state_128* rng, void* buf,
+                                   size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -251,6 +385,18 @@ pcg_setseq_128_rxs_m_xs_128_random_r(struct pcg_state_setseq_128* rng);
 extern inline pcg128_t
 pcg_setseq_128_rxs_m_xs_128_boundedrand_r(struct pcg_state_setseq_128* rng,
                                           pcg128_t bound);
+
+extern inline pcg128_t
+pcg_setseq_128_rxs_m_xs_128_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                              pcg128_t bound);
+
+extern inline pcg128_t
+pcg_setseq_128_rxs_m_xs_128_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                                const struct pcg_bound_128* b);
+
+extern inline void
+pcg_setseq_128_rxs_m_xs_128_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                                   size_t n);
 #endif
 
 /* Generation functions for RXS M */
@@ -264,6 +410,17 @@ pcg_oneseq_128_rxs_m_64_random_r(struct pcg_state_128* rng);
 extern inline uint64_t
 pcg_oneseq_128_rxs_m_64_boundedrand_r(struct pcg_state_128* rng,
                                       uint64_t bound);
+
+extern inline uint64_t
+pcg_oneseq_128_rxs_m_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                          uint64_t bound);
+
+extern inline uint64_t
+pcg_oneseq_128_rxs_m_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                            const struct pcg_bound_64* b);
+
+extern inline void
+pcg_oneseq_128_rxs_m_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -275,6 +432,17 @@ pcg_unique_128_rxs_m_64_random_r(struct pcg_state_128* rng);
 extern inline uint64_t
 pcg_unique_128_rxs_m_64_boundedrand_r(struct pcg_state_128* rng,
                                       uint64_t bound);
+
+extern inline uint64_t
+pcg_unique_128_rxs_m_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                          uint64_t bound);
+
+extern inline uint64_t
+pcg_unique_128_rxs_m_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                            const struct pcg_bound_64* b);
+
+extern inline void
+pcg_unique_128_rxs_m_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -286,6 +454,18 @@ pcg_setseq_128_rxs_m_64_random_r(struct pcg_state_setseq_128* rng);
 extern inline uint64_t
 pcg_setseq_128_rxs_m_64_boundedrand_r(struct pcg_state_setseq_128* rng,
                                       uint64_t bound);
+
+extern inline uint64_t
+pcg_setseq_128_rxs_m_64_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                          uint64_t bound);
+
+extern inline uint64_t
+pcg_setseq_128_rxs_m_64_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                            const struct pcg_bound_64* b);
+
+extern inline void
+pcg_setseq_128_rxs_m_64_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                               size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -295,6 +475,17 @@ extern inline uint64_t pcg_mcg_128_rxs_m_64_random_r(struct pcg_state_128* rng);
 #if PCG_HAS_128BIT_OPS
 extern inline uint64_t
 pcg_mcg_128_rxs_m_64_boundedrand_r(struct pcg_state_128* rng, uint64_t bound);
+
+extern inline uint64_t
+pcg_mcg_128_rxs_m_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                       uint64_t bound);
+
+extern inline uint64_t
+pcg_mcg_128_rxs_m_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                         const struct pcg_bound_64* b);
+
+extern inline void
+pcg_mcg_128_rxs_m_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
 #endif
 
 /* Generation functions for XSL RR (only defined for "large" types) */
@@ -308,6 +499,22 @@ pcg_oneseq_128_xsl_rr_64_random_r(struct pcg_state_128* rng);
 extern inline uint64_t
 pcg_oneseq_128_xsl_rr_64_boundedrand_r(struct pcg_state_128* rng,
                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_oneseq_128_xsl_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound);
+
+extern inline uint64_t
+pcg_oneseq_128_xsl_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b);
+
+extern inline void
+pcg_oneseq_128_xsl_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
+
+extern inline void
+pcg_oneseq_128_xsl_rr_64_boundedrand_fill_r(struct pcg_state_128* rng,
+                                            uint64_t bound, uint64_t* out,
+                                            size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -319,6 +526,22 @@ pcg_unique_128_xsl_rr_64_random_r(struct pcg_state_128* rng);
 extern inline uint64_t
 pcg_unique_128_xsl_rr_64_boundedrand_r(struct pcg_state_128* rng,
                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_unique_128_xsl_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                           uint64_t bound);
+
+extern inline uint64_t
+pcg_unique_128_xsl_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                             const struct pcg_bound_64* b);
+
+extern inline void
+pcg_unique_128_xsl_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
+
+extern inline void
+pcg_unique_128_xsl_rr_64_boundedrand_fill_r(struct pcg_state_128* rng,
+                                            uint64_t bound, uint64_t* out,
+                                            size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -330,6 +553,23 @@ pcg_setseq_128_xsl_rr_64_random_r(struct pcg_state_setseq_128* rng);
 extern inline uint64_t
 pcg_setseq_128_xsl_rr_64_boundedrand_r(struct pcg_state_setseq_128* rng,
                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_setseq_128_xsl_rr_64_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                           uint64_t bound);
+
+extern inline uint64_t
+pcg_setseq_128_xsl_rr_64_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                             const struct pcg_bound_64* b);
+
+extern inline void
+pcg_setseq_128_xsl_rr_64_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                                size_t n);
+
+extern inline void
+pcg_setseq_128_xsl_rr_64_boundedrand_fill_r(struct pcg_state_setseq_128* rng,
+                                            uint64_t bound, uint64_t* out,
+                                            size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -340,6 +580,22 @@ pcg_mcg_128_xsl_rr_64_random_r(struct pcg_state_128* rng);
 #if PCG_HAS_128BIT_OPS
 extern inline uint64_t
 pcg_mcg_128_xsl_rr_64_boundedrand_r(struct pcg_state_128* rng, uint64_t bound);
+
+extern inline uint64_t
+pcg_mcg_128_xsl_rr_64_boundedrand_mul_r(struct pcg_state_128* rng,
+                                        uint64_t bound);
+
+extern inline uint64_t
+pcg_mcg_128_xsl_rr_64_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                          const struct pcg_bound_64* b);
+
+extern inline void
+pcg_mcg_128_xsl_rr_64_fill_r(struct pcg_state_128* rng, void* buf, size_t n);
+
+extern inline void
+pcg_mcg_128_xsl_rr_64_boundedrand_fill_r(struct pcg_state_128* rng,
+                                         uint64_t bound, uint64_t* out,
+                                         size_t n);
 #endif
 
 /* Generation functions for XSL RR RR (only defined for "large" types) */
@@ -353,6 +609,18 @@ pcg_oneseq_128_xsl_rr_rr_128_random_r(struct pcg_state_128* rng);
 extern inline pcg128_t
 pcg_oneseq_128_xsl_rr_rr_128_boundedrand_r(struct pcg_state_128* rng,
                                            pcg128_t bound);
+
+extern inline pcg128_t
+pcg_oneseq_128_xsl_rr_rr_128_boundedrand_mul_r(struct pcg_state_128* rng,
+                                               pcg128_t bound);
+
+extern inline pcg128_t
+pcg_oneseq_128_xsl_rr_rr_128_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                                 const struct pcg_bound_128* b);
+
+extern inline void
+pcg_oneseq_128_xsl_rr_rr_128_fill_r(struct pcg_state_128* rng, void* buf,
+                                    size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -364,6 +632,18 @@ pcg_unique_128_xsl_rr_rr_128_random_r(struct pcg_state_128* rng);
 extern inline pcg128_t
 pcg_unique_128_xsl_rr_rr_128_boundedrand_r(struct pcg_state_128* rng,
                                            pcg128_t bound);
+
+extern inline pcg128_t
+pcg_unique_128_xsl_rr_rr_128_boundedrand_mul_r(struct pcg_state_128* rng,
+                                               pcg128_t bound);
+
+extern inline pcg128_t
+pcg_unique_128_xsl_rr_rr_128_boundedrand_fixed_r(struct pcg_state_128* rng,
+                                                 const struct pcg_bound_128* b);
+
+extern inline void
+pcg_unique_128_xsl_rr_rr_128_fill_r(struct pcg_state_128* rng, void* buf,
+                                    size_t n);
 #endif
 
 #if PCG_HAS_128BIT_OPS
@@ -375,5 +655,17 @@ pcg_setseq_128_xsl_rr_rr_128_random_r(struct pcg_state_setseq_128* rng);
 extern inline pcg128_t
 pcg_setseq_128_xsl_rr_rr_128_boundedrand_r(struct pcg_state_setseq_128* rng,
                                            pcg128_t bound);
+
+extern inline pcg128_t
+pcg_setseq_128_xsl_rr_rr_128_boundedrand_mul_r(struct pcg_state_setseq_128* rng,
+                                               pcg128_t bound);
+
+extern inline pcg128_t
+pcg_setseq_128_xsl_rr_rr_128_boundedrand_fixed_r(struct pcg_state_setseq_128* rng,
+                                                 const struct pcg_bound_128* b);
+
+extern inline void
+pcg_setseq_128_xsl_rr_rr_128_fill_r(struct pcg_state_setseq_128* rng, void* buf,
+                                    size_t n);
 #endif
 
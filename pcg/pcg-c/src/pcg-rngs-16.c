@@ -109,11 +109,33 @@ extern inline uint8_t pcg_oneseq_16_xsh_rs_8_random_r(struct pcg_state_16* rng);
 extern inline uint8_t
 pcg_oneseq_16_xsh_rs_8_boundedrand_r(struct pcg_state_16* rng, uint8_t bound);
 
+extern inline uint8_t
+pcg_oneseq_16_xsh_rs_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                         uint8_t bound);
+
+extern inline uint8_t
+pcg_oneseq_16_xsh_rs_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                           const struct pcg_bound_8* b);
+
+extern inline void
+pcg_oneseq_16_xsh_rs_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 extern inline uint8_t pcg_unique_16_xsh_rs_8_random_r(struct pcg_state_16* rng);
 
 extern inline uint8_t
 pcg_unique_16_xsh_rs_8_boundedrand_r(struct pcg_state_16* rng, uint8_t bound);
 
+extern inline uint8_t
+pcg_unique_16_xsh_rs_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                         uint8_t bound);
+
+extern inline uint8_t
+pcg_unique_16_xsh_rs_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                           const struct pcg_bound_8* b);
+
+extern inline void
+pcg_unique_16_xsh_rs_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 extern inline uint8_t
 pcg_setseq_16_xsh_rs_8_random_r(struct pcg_state_setseq_16* rng);
 
@@ -121,11 +143,33 @@ extern inline uint8_t
 pcg_setseq_16_xsh_rs_8_boundedrand_r(struct pcg_state_setseq_16* rng,
                                      uint8_t bound);
 
+extern inline uint8_t
+pcg_setseq_16_xsh_rs_8_boundedrand_mul_r(struct pcg_state_setseq_16* rng,
+                                         uint8_t bound);
+
+extern inline uint8_t
+pcg_setseq_16_xsh_rs_8_boundedrand_fixed_r(struct pcg_state_setseq_16* rng,
+                                           const struct pcg_bound_8* b);
+
+extern inline void
+pcg_setseq_16_xsh_rs_8_fill_r(struct pcg_state_setseq_16* rng, void* buf,
+                              size_t n);
+
 extern inline uint8_t pcg_mcg_16_xsh_rs_8_random_r(struct pcg_state_16* rng);
 
 extern inline uint8_t
 pcg_mcg_16_xsh_rs_8_boundedrand_r(struct pcg_state_16* rng, uint8_t bound);
 
+extern inline uint8_t
+pcg_mcg_16_xsh_rs_8_boundedrand_mul_r(struct pcg_state_16* rng, uint8_t bound);
+
+extern inline uint8_t
+pcg_mcg_16_xsh_rs_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                        const struct pcg_bound_8* b);
+
+extern inline void
+pcg_mcg_16_xsh_rs_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 /* Generation functions for XSH RR */
 
 extern inline uint8_t pcg_oneseq_16_xsh_rr_8_random_r(struct pcg_state_16* rng);
@@ -133,11 +177,33 @@ extern inline uint8_t pcg_oneseq_16_xsh_rr_8_random_r(struct pcg_state_16* rng);
 extern inline uint8_t
 pcg_oneseq_16_xsh_rr_8_boundedrand_r(struct pcg_state_16* rng, uint8_t bound);
 
+extern inline uint8_t
+pcg_oneseq_16_xsh_rr_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                         uint8_t bound);
+
+extern inline uint8_t
+pcg_oneseq_16_xsh_rr_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                           const struct pcg_bound_8* b);
+
+extern inline void
+pcg_oneseq_16_xsh_rr_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 extern inline uint8_t pcg_unique_16_xsh_rr_8_random_r(struct pcg_state_16* rng);
 
 extern inline uint8_t
 pcg_unique_16_xsh_rr_8_boundedrand_r(struct pcg_state_16* rng, uint8_t bound);
 
+extern inline uint8_t
+pcg_unique_16_xsh_rr_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                         uint8_t bound);
+
+extern inline uint8_t
+pcg_unique_16_xsh_rr_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                           const struct pcg_bound_8* b);
+
+extern inline void
+pcg_unique_16_xsh_rr_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 extern inline uint8_t
 pcg_setseq_16_xsh_rr_8_random_r(struct pcg_state_setseq_16* rng);
 
@@ -145,11 +211,33 @@ extern inline uint8_t
 pcg_setseq_16_xsh_rr_8_boundedrand_r(struct pcg_state_setseq_16* rng,
                                      uint8_t bound);
 
+extern inline uint8_t
+pcg_setseq_16_xsh_rr_8_boundedrand_mul_r(struct pcg_state_setseq_16* rng,
+                                         uint8_t bound);
+
+extern inline uint8_t
+pcg_setseq_16_xsh_rr_8_boundedrand_fixed_r(struct pcg_state_setseq_16* rng,
+                                           const struct pcg_bound_8* b);
+
+extern inline void
+pcg_setseq_16_xsh_rr_8_fill_r(struct pcg_state_setseq_16* rng, void* buf,
+                              size_t n);
+
 extern inline uint8_t pcg_mcg_16_xsh_rr_8_random_r(struct pcg_state_16* rng);
 
 extern inline uint8_t
 pcg_mcg_16_xsh_rr_8_boundedrand_r(struct pcg_state_16* rng, uint8_t bound);
 
+extern inline uint8_t
+pcg_mcg_16_xsh_rr_8_boundedrand_mul_r(struct pcg_state_16* rng, uint8_t bound);
+
+extern inline uint8_t
+pcg_mcg_16_xsh_rr_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                        const struct pcg_bound_8* b);
+
+extern inline void
+pcg_mcg_16_xsh_rr_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 /* Generation functions for RXS M XS (no MCG versions because they
  * don't make sense when you want to use the entire state)
  */
@@ -161,6 +249,17 @@ extern inline uint16_t
 pcg_oneseq_16_rxs_m_xs_16_boundedrand_r(struct pcg_state_16* rng,
                                         uint16_t bound);
 
+extern inline uint16_t
+pcg_oneseq_16_rxs_m_xs_16_boundedrand_mul_r(struct pcg_state_16* rng,
+                                            uint16_t bound);
+
+extern inline uint16_t
+pcg_oneseq_16_rxs_m_xs_16_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                              const struct pcg_bound_16* b);
+
+extern inline void
+pcg_oneseq_16_rxs_m_xs_16_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 extern inline uint16_t
 pcg_unique_16_rxs_m_xs_16_random_r(struct pcg_state_16* rng);
 
@@ -168,6 +267,17 @@ extern inline uint16_t
 pcg_unique_16_rxs_m_xs_16_boundedrand_r(struct pcg_state_16* rng,
                                         uint16_t bound);
 
+extern inline uint16_t
+pcg_unique_16_rxs_m_xs_16_boundedrand_mul_r(struct pcg_state_16* rng,
+                                            uint16_t bound);
+
+extern inline uint16_t
+pcg_unique_16_rxs_m_xs_16_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                              const struct pcg_bound_16* b);
+
+extern inline void
+pcg_unique_16_rxs_m_xs_16_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 extern inline uint16_t
 pcg_setseq_16_rxs_m_xs_16_random_r(struct pcg_state_setseq_16* rng);
 
@@ -175,6 +285,18 @@ extern inline uint16_t
 pcg_setseq_16_rxs_m_xs_16_boundedrand_r(struct pcg_state_setseq_16* rng,
                                         uint16_t bound);
 
+extern inline uint16_t
+pcg_setseq_16_rxs_m_xs_16_boundedrand_mul_r(struct pcg_state_setseq_16* rng,
+                                            uint16_t bound);
+
+extern inline uint16_t
+pcg_setseq_16_rxs_m_xs_16_boundedrand_fixed_r(struct pcg_state_setseq_16* rng,
+                                              const struct pcg_bound_16* b);
+
+extern inline void
+pcg_setseq_16_rxs_m_xs_16_fill_r(struct pcg_state_setseq_16* rng, void* buf,
+                                 size_t n);
+
 /* Generation functions for RXS M */
 
 extern inline uint8_t pcg_oneseq_16_rxs_m_8_random_r(struct pcg_state_16* rng);
@@ -182,11 +304,33 @@ extern inline uint8_t pcg_oneseq_16_rxs_m_8_random_r(struct pcg_state_16* rng);
 extern inline uint8_t
 pcg_oneseq_16_rxs_m_8_boundedrand_r(struct pcg_state_16* rng, uint8_t bound);
 
+extern inline uint8_t
+pcg_oneseq_16_rxs_m_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                        uint8_t bound);
+
+extern inline uint8_t
+pcg_oneseq_16_rxs_m_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                          const struct pcg_bound_8* b);
+
+extern inline void
+pcg_oneseq_16_rxs_m_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 extern inline uint8_t pcg_unique_16_rxs_m_8_random_r(struct pcg_state_16* rng);
 
 extern inline uint8_t
 pcg_unique_16_rxs_m_8_boundedrand_r(struct pcg_state_16* rng, uint8_t bound);
 
+extern inline uint8_t
+pcg_unique_16_rxs_m_8_boundedrand_mul_r(struct pcg_state_16* rng,
+                                        uint8_t bound);
+
+extern inline uint8_t
+pcg_unique_16_rxs_m_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                          const struct pcg_bound_8* b);
+
+extern inline void
+pcg_unique_16_rxs_m_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 extern inline uint8_t
 pcg_setseq_16_rxs_m_8_random_r(struct pcg_state_setseq_16* rng);
 
@@ -194,11 +338,33 @@ extern inline uint8_t
 pcg_setseq_16_rxs_m_8_boundedrand_r(struct pcg_state_setseq_16* rng,
                                     uint8_t bound);
 
+extern inline uint8_t
+pcg_setseq_16_rxs_m_8_boundedrand_mul_r(struct pcg_state_setseq_16* rng,
+                                        uint8_t bound);
+
+extern inline uint8_t
+pcg_setseq_16_rxs_m_8_boundedrand_fixed_r(struct pcg_state_setseq_16* rng,
+                                          const struct pcg_bound_8* b);
+
+extern inline void
+pcg_setseq_16_rxs_m_8_fill_r(struct pcg_state_setseq_16* rng, void* buf,
+                             size_t n);
+
 extern inline uint8_t pcg_mcg_16_rxs_m_8_random_r(struct pcg_state_16* rng);
 
 extern inline uint8_t pcg_mcg_16_rxs_m_8_boundedrand_r(struct pcg_state_16* rng,
                                                        uint8_t bound);
 
+extern inline uint8_t
+pcg_mcg_16_rxs_m_8_boundedrand_mul_r(struct pcg_state_16* rng, uint8_t bound);
+
+extern inline uint8_t
+pcg_mcg_16_rxs_m_8_boundedrand_fixed_r(struct pcg_state_16* rng,
+                                       const struct pcg_bound_8* b);
+
+extern inline void
+pcg_mcg_16_rxs_m_8_fill_r(struct pcg_state_16* rng, void* buf, size_t n);
+
 /* Generation functions for XSL RR (only defined for "large" types) */
 
 /* Generation functions for XSL RR RR (only defined for "large" types) */
@@ -110,12 +110,34 @@ pcg_oneseq_32_xsh_rs_16_random_r(struct pcg_state_32* rng);
 extern inline uint16_t
 pcg_oneseq_32_xsh_rs_16_boundedrand_r(struct pcg_state_32* rng, uint16_t bound);
 
+extern inline uint16_t
+pcg_oneseq_32_xsh_rs_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                          uint16_t bound);
+
+extern inline uint16_t
+pcg_oneseq_32_xsh_rs_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                            const struct pcg_bound_16* b);
+
+extern inline void
+pcg_oneseq_32_xsh_rs_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 extern inline uint16_t
 pcg_unique_32_xsh_rs_16_random_r(struct pcg_state_32* rng);
 
 extern inline uint16_t
 pcg_unique_32_xsh_rs_16_boundedrand_r(struct pcg_state_32* rng, uint16_t bound);
 
+extern inline uint16_t
+pcg_unique_32_xsh_rs_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                          uint16_t bound);
+
+extern inline uint16_t
+pcg_unique_32_xsh_rs_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                            const struct pcg_bound_16* b);
+
+extern inline void
+pcg_unique_32_xsh_rs_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 extern inline uint16_t
 pcg_setseq_32_xsh_rs_16_random_r(struct pcg_state_setseq_32* rng);
 
@@ -123,11 +145,34 @@ extern inline uint16_t
 pcg_setseq_32_xsh_rs_16_boundedrand_r(struct pcg_state_setseq_32* rng,
                                       uint16_t bound);
 
+extern inline uint16_t
+pcg_setseq_32_xsh_rs_16_boundedrand_mul_r(struct pcg_state_setseq_32* rng,
+                                          uint16_t bound);
+
+extern inline uint16_t
+pcg_setseq_32_xsh_rs_16_boundedrand_fixed_r(struct pcg_state_setseq_32* rng,
+                                            const struct pcg_bound_16* b);
+
+extern inline void
+pcg_setseq_32_xsh_rs_16_fill_r(struct pcg_state_setseq_32* rng, void* buf,
+                               size_t n);
+
 extern inline uint16_t pcg_mcg_32_xsh_rs_16_random_r(struct pcg_state_32* rng);
 
 extern inline uint16_t
 pcg_mcg_32_xsh_rs_16_boundedrand_r(struct pcg_state_32* rng, uint16_t bound);
 
+extern inline uint16_t
+pcg_mcg_32_xsh_rs_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                       uint16_t bound);
+
+extern inline uint16_t
+pcg_mcg_32_xsh_rs_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                         const struct pcg_bound_16* b);
+
+extern inline void
+pcg_mcg_32_xsh_rs_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 /* Generation functions for XSH RR */
 
 extern inline uint16_t
@@ -136,12 +181,34 @@ pcg_oneseq_32_xsh_rr_16_random_r(struct pcg_state_32* rng);
 extern inline uint16_t
 pcg_oneseq_32_xsh_rr_16_boundedrand_r(struct pcg_state_32* rng, uint16_t bound);
 
+extern inline uint16_t
+pcg_oneseq_32_xsh_rr_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                          uint16_t bound);
+
+extern inline uint16_t
+pcg_oneseq_32_xsh_rr_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                            const struct pcg_bound_16* b);
+
+extern inline void
+pcg_oneseq_32_xsh_rr_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 extern inline uint16_t
 pcg_unique_32_xsh_rr_16_random_r(struct pcg_state_32* rng);
 
 extern inline uint16_t
 pcg_unique_32_xsh_rr_16_boundedrand_r(struct pcg_state_32* rng, uint16_t bound);
 
+extern inline uint16_t
+pcg_unique_32_xsh_rr_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                          uint16_t bound);
+
+extern inline uint16_t
+pcg_unique_32_xsh_rr_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                            const struct pcg_bound_16* b);
+
+extern inline void
+pcg_unique_32_xsh_rr_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 extern inline uint16_t
 pcg_setseq_32_xsh_rr_16_random_r(struct pcg_state_setseq_32* rng);
 
@@ -149,11 +216,34 @@ extern inline uint16_t
 pcg_setseq_32_xsh_rr_16_boundedrand_r(struct pcg_state_setseq_32* rng,
                                       uint16_t bound);
 
+extern inline uint16_t
+pcg_setseq_32_xsh_rr_16_boundedrand_mul_r(struct pcg_state_setseq_32* rng,
+                                          uint16_t bound);
+
+extern inline uint16_t
+pcg_setseq_32_xsh_rr_16_boundedrand_fixed_r(struct pcg_state_setseq_32* rng,
+                                            const struct pcg_bound_16* b);
+
+extern inline void
+pcg_setseq_32_xsh_rr_16_fill_r(struct pcg_state_setseq_32* rng, void* buf,
+                               size_t n);
+
 extern inline uint16_t pcg_mcg_32_xsh_rr_16_random_r(struct pcg_state_32* rng);
 
 extern inline uint16_t
 pcg_mcg_32_xsh_rr_16_boundedrand_r(struct pcg_state_32* rng, uint16_t bound);
 
+extern inline uint16_t
+pcg_mcg_32_xsh_rr_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                       uint16_t bound);
+
+extern inline uint16_t
+pcg_mcg_32_xsh_rr_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                         const struct pcg_bound_16* b);
+
+extern inline void
+pcg_mcg_32_xsh_rr_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 /* Generation functions for RXS M XS (no MCG versions because they
  * don't make sense when you want to use the entire state)
  */
@@ -165,6 +255,17 @@ extern inline uint32_t
 pcg_oneseq_32_rxs_m_xs_32_boundedrand_r(struct pcg_state_32* rng,
                                         uint32_t bound);
 
+extern inline uint32_t
+pcg_oneseq_32_rxs_m_xs_32_boundedrand_mul_r(struct pcg_state_32* rng,
+                                            uint32_t bound);
+
+extern inline uint32_t
+pcg_oneseq_32_rxs_m_xs_32_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                              const struct pcg_bound_32* b);
+
+extern inline void
+pcg_oneseq_32_rxs_m_xs_32_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 extern inline uint32_t
 pcg_unique_32_rxs_m_xs_32_random_r(struct pcg_state_32* rng);
 
@@ -172,6 +273,17 @@ extern inline uint32_t
 pcg_unique_32_rxs_m_xs_32_boundedrand_r(struct pcg_state_32* rng,
                                         uint32_t bound);
 
+extern inline uint32_t
+pcg_unique_32_rxs_m_xs_32_boundedrand_mul_r(struct pcg_state_32* rng,
+                                            uint32_t bound);
+
+extern inline uint32_t
+pcg_unique_32_rxs_m_xs_32_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                              const struct pcg_bound_32* b);
+
+extern inline void
+pcg_unique_32_rxs_m_xs_32_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 extern inline uint32_t
 pcg_setseq_32_rxs_m_xs_32_random_r(struct pcg_state_setseq_32* rng);
 
@@ -179,6 +291,18 @@ extern inline uint32_t
 pcg_setseq_32_rxs_m_xs_32_boundedrand_r(struct pcg_state_setseq_32* rng,
                                         uint32_t bound);
 
+extern inline uint32_t
+pcg_setseq_32_rxs_m_xs_32_boundedrand_mul_r(struct pcg_state_setseq_32* rng,
+                                            uint32_t bound);
+
+extern inline uint32_t
+pcg_setseq_32_rxs_m_xs_32_boundedrand_fixed_r(struct pcg_state_setseq_32* rng,
+                                              const struct pcg_bound_32* b);
+
+extern inline void
+pcg_setseq_32_rxs_m_xs_32_fill_r(struct pcg_state_setseq_32* rng, void* buf,
+                                 size_t n);
+
 /* Generation functions for RXS M */
 
 extern inline uint16_t
@@ -187,12 +311,34 @@ pcg_oneseq_32_rxs_m_16_random_r(struct pcg_state_32* rng);
 extern inline uint16_t
 pcg_oneseq_32_rxs_m_16_boundedrand_r(struct pcg_state_32* rng, uint16_t bound);
 
+extern inline uint16_t
+pcg_oneseq_32_rxs_m_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                         uint16_t bound);
+
+extern inline uint16_t
+pcg_oneseq_32_rxs_m_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                           const struct pcg_bound_16* b);
+
+extern inline void
+pcg_oneseq_32_rxs_m_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 extern inline uint16_t
 pcg_unique_32_rxs_m_16_random_r(struct pcg_state_32* rng);
 
 extern inline uint16_t
 pcg_unique_32_rxs_m_16_boundedrand_r(struct pcg_state_32* rng, uint16_t bound);
 
+extern inline uint16_t
+pcg_unique_32_rxs_m_16_boundedrand_mul_r(struct pcg_state_32* rng,
+                                         uint16_t bound);
+
+extern inline uint16_t
+pcg_unique_32_rxs_m_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                           const struct pcg_bound_16* b);
+
+extern inline void
+pcg_unique_32_rxs_m_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 extern inline uint16_t
 pcg_setseq_32_rxs_m_16_random_r(struct pcg_state_setseq_32* rng);
 
@@ -200,11 +346,33 @@ extern inline uint16_t
 pcg_setseq_32_rxs_m_16_boundedrand_r(struct pcg_state_setseq_32* rng,
                                      uint16_t bound);
 
+extern inline uint16_t
+pcg_setseq_32_rxs_m_16_boundedrand_mul_r(struct pcg_state_setseq_32* rng,
+                                         uint16_t bound);
+
+extern inline uint16_t
+pcg_setseq_32_rxs_m_16_boundedrand_fixed_r(struct pcg_state_setseq_32* rng,
+                                           const struct pcg_bound_16* b);
+
+extern inline void
+pcg_setseq_32_rxs_m_16_fill_r(struct pcg_state_setseq_32* rng, void* buf,
+                              size_t n);
+
 extern inline uint16_t pcg_mcg_32_rxs_m_16_random_r(struct pcg_state_32* rng);
 
 extern inline uint16_t
 pcg_mcg_32_rxs_m_16_boundedrand_r(struct pcg_state_32* rng, uint16_t bound);
 
+extern inline uint16_t
+pcg_mcg_32_rxs_m_16_boundedrand_mul_r(struct pcg_state_32* rng, uint16_t bound);
+
+extern inline uint16_t
+pcg_mcg_32_rxs_m_16_boundedrand_fixed_r(struct pcg_state_32* rng,
+                                        const struct pcg_bound_16* b);
+
+extern inline void
+pcg_mcg_32_rxs_m_16_fill_r(struct pcg_state_32* rng, void* buf, size_t n);
+
 /* Generation functions for XSL RR (only defined for "large" types) */
 
 /* Generation functions for XSL RR RR (only defined for "large" types) */
@@ -55,6 +55,20 @@ extern inline void pcg_setseq_64_step_r(struct pcg_state_setseq_64* rng);
 extern inline void pcg_setseq_64_advance_r(struct pcg_state_setseq_64* rng,
                                            uint64_t delta);
 
+extern inline void
+pcg_setseq_64_partition_r(struct pcg_partition_setseq_64* part,
+                          const struct pcg_state_setseq_64* rng,
+                          uint64_t blocksize);
+
+extern inline void
+pcg_setseq_64_partition_block_r(const struct pcg_partition_setseq_64* part,
+                                uint64_t k, struct pcg_state_setseq_64* rng);
+
+extern inline void
+pcg_setseq_64_partition_fill_r(const struct pcg_partition_setseq_64* part,
+                               uint64_t first,
+                               struct pcg_state_setseq_64* rngs, size_t n);
+
 /* Functions to seed the RNG state, one version for each size and each
  * style.  Unlike the step functions, regular users can and should call
  * these functions.
@@ -110,12 +124,34 @@ pcg_oneseq_64_xsh_rs_32_random_r(struct pcg_state_64* rng);
 extern inline uint32_t
 pcg_oneseq_64_xsh_rs_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_oneseq_64_xsh_rs_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound);
+
+extern inline uint32_t
+pcg_oneseq_64_xsh_rs_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b);
+
+extern inline void
+pcg_oneseq_64_xsh_rs_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 extern inline uint32_t
 pcg_unique_64_xsh_rs_32_random_r(struct pcg_state_64* rng);
 
 extern inline uint32_t
 pcg_unique_64_xsh_rs_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_unique_64_xsh_rs_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound);
+
+extern inline uint32_t
+pcg_unique_64_xsh_rs_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b);
+
+extern inline void
+pcg_unique_64_xsh_rs_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 extern inline uint32_t
 pcg_setseq_64_xsh_rs_32_random_r(struct pcg_state_setseq_64* rng);
 
@@ -123,11 +159,39 @@ extern inline uint32_t
 pcg_setseq_64_xsh_rs_32_boundedrand_r(struct pcg_state_setseq_64* rng,
                                       uint32_t bound);
 
+extern inline uint32_t
+pcg_setseq_64_xsh_rs_32_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                          uint32_t bound);
+
+extern inline uint32_t
+pcg_setseq_64_xsh_rs_32_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                            const struct pcg_bound_32* b);
+
+extern inline void
+pcg_setseq_64_xsh_rs_32_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                               size_t n);
+
 extern inline uint32_t pcg_mcg_64_xsh_rs_32_random_r(struct pcg_state_64* rng);
 
 extern inline uint32_t
 pcg_mcg_64_xsh_rs_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_mcg_64_xsh_rs_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                       uint32_t bound);
+
+extern inline uint32_t
+pcg_mcg_64_xsh_rs_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                         const struct pcg_bound_32* b);
+
+extern inline void
+pcg_mcg_64_xsh_rs_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
+extern inline void
+pcg_mcg_64_xsh_rs_32_boundedrand_fill_r(struct pcg_state_64* rng,
+                                        uint32_t bound, uint32_t* out,
+                                        size_t n);
+
 /* Generation functions for XSH RR */
 
 extern inline uint32_t
@@ -136,12 +200,44 @@ pcg_oneseq_64_xsh_rr_32_random_r(struct pcg_state_64* rng);
 extern inline uint32_t
 pcg_oneseq_64_xsh_rr_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_oneseq_64_xsh_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound);
+
+extern inline uint32_t
+pcg_oneseq_64_xsh_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b);
+
+extern inline void
+pcg_oneseq_64_xsh_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
+extern inline void
+pcg_oneseq_64_xsh_rr_32_boundedrand_fill_r(struct pcg_state_64* rng,
+                                           uint32_t bound, uint32_t* out,
+                                           size_t n);
+
 extern inline uint32_t
 pcg_unique_64_xsh_rr_32_random_r(struct pcg_state_64* rng);
 
 extern inline uint32_t
 pcg_unique_64_xsh_rr_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_unique_64_xsh_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound);
+
+extern inline uint32_t
+pcg_unique_64_xsh_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b);
+
+extern inline void
+pcg_unique_64_xsh_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
+extern inline void
+pcg_unique_64_xsh_rr_32_boundedrand_fill_r(struct pcg_state_64* rng,
+                                           uint32_t bound, uint32_t* out,
+                                           size_t n);
+
 extern inline uint32_t
 pcg_setseq_64_xsh_rr_32_random_r(struct pcg_state_setseq_64* rng);
 
@@ -149,11 +245,39 @@ extern inline uint32_t
 pcg_setseq_64_xsh_rr_32_boundedrand_r(struct pcg_state_setseq_64* rng,
                                       uint32_t bound);
 
+extern inline uint32_t
+pcg_setseq_64_xsh_rr_32_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                          uint32_t bound);
+
+extern inline uint32_t
+pcg_setseq_64_xsh_rr_32_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                            const struct pcg_bound_32* b);
+
+extern inline void
+pcg_setseq_64_xsh_rr_32_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                               size_t n);
+
+extern inline void
+pcg_setseq_64_xsh_rr_32_boundedrand_fill_r(struct pcg_state_setseq_64* rng,
+                                           uint32_t bound, uint32_t* out,
+                                           size_t n);
+
 extern inline uint32_t pcg_mcg_64_xsh_rr_32_random_r(struct pcg_state_64* rng);
 
 extern inline uint32_t
 pcg_mcg_64_xsh_rr_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_mcg_64_xsh_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                       uint32_t bound);
+
+extern inline uint32_t
+pcg_mcg_64_xsh_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                         const struct pcg_bound_32* b);
+
+extern inline void
+pcg_mcg_64_xsh_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 /* Generation functions for RXS M XS (no MCG versions because they
  * don't make sense when you want to use the entire state)
  */
@@ -165,6 +289,17 @@ extern inline uint64_t
 pcg_oneseq_64_rxs_m_xs_64_boundedrand_r(struct pcg_state_64* rng,
                                         uint64_t bound);
 
+extern inline uint64_t
+pcg_oneseq_64_rxs_m_xs_64_boundedrand_mul_r(struct pcg_state_64* rng,
+                                            uint64_t bound);
+
+extern inline uint64_t
+pcg_oneseq_64_rxs_m_xs_64_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                              const struct pcg_bound_64* b);
+
+extern inline void
+pcg_oneseq_64_rxs_m_xs_64_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 extern inline uint64_t
 pcg_unique_64_rxs_m_xs_64_random_r(struct pcg_state_64* rng);
 
@@ -172,6 +307,17 @@ extern inline uint64_t
 pcg_unique_64_rxs_m_xs_64_boundedrand_r(struct pcg_state_64* rng,
                                         uint64_t bound);
 
+extern inline uint64_t
+pcg_unique_64_rxs_m_xs_64_boundedrand_mul_r(struct pcg_state_64* rng,
+                                            uint64_t bound);
+
+extern inline uint64_t
+pcg_unique_64_rxs_m_xs_64_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                              const struct pcg_bound_64* b);
+
+extern inline void
+pcg_unique_64_rxs_m_xs_64_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 extern inline uint64_t
 pcg_setseq_64_rxs_m_xs_64_random_r(struct pcg_state_setseq_64* rng);
 
@@ -179,6 +325,18 @@ extern inline uint64_t
 pcg_setseq_64_rxs_m_xs_64_boundedrand_r(struct pcg_state_setseq_64* rng,
                                         uint64_t bound);
 
+extern inline uint64_t
+pcg_setseq_64_rxs_m_xs_64_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                            uint64_t bound);
+
+extern inline uint64_t
+pcg_setseq_64_rxs_m_xs_64_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                              const struct pcg_bound_64* b);
+
+extern inline void
+pcg_setseq_64_rxs_m_xs_64_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                                 size_t n);
+
 /* Generation functions for RXS M */
 
 extern inline uint32_t
@@ -187,12 +345,34 @@ pcg_oneseq_64_rxs_m_32_random_r(struct pcg_state_64* rng);
 extern inline uint32_t
 pcg_oneseq_64_rxs_m_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_oneseq_64_rxs_m_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                         uint32_t bound);
+
+extern inline uint32_t
+pcg_oneseq_64_rxs_m_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                           const struct pcg_bound_32* b);
+
+extern inline void
+pcg_oneseq_64_rxs_m_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 extern inline uint32_t
 pcg_unique_64_rxs_m_32_random_r(struct pcg_state_64* rng);
 
 extern inline uint32_t
 pcg_unique_64_rxs_m_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_unique_64_rxs_m_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                         uint32_t bound);
+
+extern inline uint32_t
+pcg_unique_64_rxs_m_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                           const struct pcg_bound_32* b);
+
+extern inline void
+pcg_unique_64_rxs_m_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 extern inline uint32_t
 pcg_setseq_64_rxs_m_32_random_r(struct pcg_state_setseq_64* rng);
 
@@ -200,11 +380,33 @@ extern inline uint32_t
 pcg_setseq_64_rxs_m_32_boundedrand_r(struct pcg_state_setseq_64* rng,
                                      uint32_t bound);
 
+extern inline uint32_t
+pcg_setseq_64_rxs_m_32_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                         uint32_t bound);
+
+extern inline uint32_t
+pcg_setseq_64_rxs_m_32_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                           const struct pcg_bound_32* b);
+
+extern inline void
+pcg_setseq_64_rxs_m_32_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                              size_t n);
+
 extern inline uint32_t pcg_mcg_64_rxs_m_32_random_r(struct pcg_state_64* rng);
 
 extern inline uint32_t
 pcg_mcg_64_rxs_m_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_mcg_64_rxs_m_32_boundedrand_mul_r(struct pcg_state_64* rng, uint32_t bound);
+
+extern inline uint32_t
+pcg_mcg_64_rxs_m_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                        const struct pcg_bound_32* b);
+
+extern inline void
+pcg_mcg_64_rxs_m_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 /* Generation functions for XSL RR (only defined for "large" types) */
 
 extern inline uint32_t
@@ -213,12 +415,34 @@ pcg_oneseq_64_xsl_rr_32_random_r(struct pcg_state_64* rng);
 extern inline uint32_t
 pcg_oneseq_64_xsl_rr_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_oneseq_64_xsl_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound);
+
+extern inline uint32_t
+pcg_oneseq_64_xsl_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b);
+
+extern inline void
+pcg_oneseq_64_xsl_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 extern inline uint32_t
 pcg_unique_64_xsl_rr_32_random_r(struct pcg_state_64* rng);
 
 extern inline uint32_t
 pcg_unique_64_xsl_rr_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_unique_64_xsl_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                          uint32_t bound);
+
+extern inline uint32_t
+pcg_unique_64_xsl_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                            const struct pcg_bound_32* b);
+
+extern inline void
+pcg_unique_64_xsl_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 extern inline uint32_t
 pcg_setseq_64_xsl_rr_32_random_r(struct pcg_state_setseq_64* rng);
 
@@ -226,11 +450,34 @@ extern inline uint32_t
 pcg_setseq_64_xsl_rr_32_boundedrand_r(struct pcg_state_setseq_64* rng,
                                       uint32_t bound);
 
+extern inline uint32_t
+pcg_setseq_64_xsl_rr_32_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                          uint32_t bound);
+
+extern inline uint32_t
+pcg_setseq_64_xsl_rr_32_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                            const struct pcg_bound_32* b);
+
+extern inline void
+pcg_setseq_64_xsl_rr_32_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                               size_t n);
+
 extern inline uint32_t pcg_mcg_64_xsl_rr_32_random_r(struct pcg_state_64* rng);
 
 extern inline uint32_t
 pcg_mcg_64_xsl_rr_32_boundedrand_r(struct pcg_state_64* rng, uint32_t bound);
 
+extern inline uint32_t
+pcg_mcg_64_xsl_rr_32_boundedrand_mul_r(struct pcg_state_64* rng,
+                                       uint32_t bound);
+
+extern inline uint32_t
+pcg_mcg_64_xsl_rr_32_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                         const struct pcg_bound_32* b);
+
+extern inline void
+pcg_mcg_64_xsl_rr_32_fill_r(struct pcg_state_64* rng, void* buf, size_t n);
+
 /* Generation functions for XSL RR RR (only defined for "large" types) */
 
 extern inline uint64_t
@@ -240,6 +487,18 @@ extern inline uint64_t
 pcg_oneseq_64_xsl_rr_rr_64_boundedrand_r(struct pcg_state_64* rng,
                                          uint64_t bound);
 
+extern inline uint64_t
+pcg_oneseq_64_xsl_rr_rr_64_boundedrand_mul_r(struct pcg_state_64* rng,
+                                             uint64_t bound);
+
+extern inline uint64_t
+pcg_oneseq_64_xsl_rr_rr_64_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                               const struct pcg_bound_64* b);
+
+extern inline void
+pcg_oneseq_64_xsl_rr_rr_64_fill_r(struct pcg_state_64* rng, void* buf,
+                                  size_t n);
+
 extern inline uint64_t
 pcg_unique_64_xsl_rr_rr_64_random_r(struct pcg_state_64* rng);
 
@@ -247,6 +506,18 @@ extern inline uint64_t
 pcg_unique_64_xsl_rr_rr_64_boundedrand_r(struct pcg_state_64* rng,
                                          uint64_t bound);
 
+extern inline uint64_t
+pcg_unique_64_xsl_rr_rr_64_boundedrand_mul_r(struct pcg_state_64* rng,
+                                             uint64_t bound);
+
+extern inline uint64_t
+pcg_unique_64_xsl_rr_rr_64_boundedrand_fixed_r(struct pcg_state_64* rng,
+                                               const struct pcg_bound_64* b);
+
+extern inline void
+pcg_unique_64_xsl_rr_rr_64_fill_r(struct pcg_state_64* rng, void* buf,
+                                  size_t n);
+
 extern inline uint64_t
 pcg_setseq_64_xsl_rr_rr_64_random_r(struct pcg_state_setseq_64* rng);
 
@@ -254,3 +525,15 @@ extern inline uint64_t
 pcg_setseq_64_xsl_rr_rr_64_boundedrand_r(struct pcg_state_setseq_64* rng,
                                          uint64_t bound);
 
+extern inline uint64_t
+pcg_setseq_64_xsl_rr_rr_64_boundedrand_mul_r(struct pcg_state_setseq_64* rng,
+                                             uint64_t bound);
+
+extern inline uint64_t
+pcg_setseq_64_xsl_rr_rr_64_boundedrand_fixed_r(struct pcg_state_setseq_64* rng,
+                                               const struct pcg_bound_64* b);
+
+extern inline void
+pcg_setseq_64_xsl_rr_rr_64_fill_r(struct pcg_state_setseq_64* rng, void* buf,
+                                  size_t n);
+
@@ -113,6 +113,17 @@ extern inline uint8_t pcg_oneseq_8_rxs_m_xs_8_random_r(struct pcg_state_8* rng);
 extern inline uint8_t
 pcg_oneseq_8_rxs_m_xs_8_boundedrand_r(struct pcg_state_8* rng, uint8_t bound);
 
+extern inline uint8_t
+pcg_oneseq_8_rxs_m_xs_8_boundedrand_mul_r(struct pcg_state_8* rng,
+                                          uint8_t bound);
+
+extern inline uint8_t
+pcg_oneseq_8_rxs_m_xs_8_boundedrand_fixed_r(struct pcg_state_8* rng,
+                                            const struct pcg_bound_8* b);
+
+extern inline void
+pcg_oneseq_8_rxs_m_xs_8_fill_r(struct pcg_state_8* rng, void* buf, size_t n);
+
 extern inline uint8_t
 pcg_setseq_8_rxs_m_xs_8_random_r(struct pcg_state_setseq_8* rng);
 
@@ -120,6 +131,18 @@ extern inline uint8_t
 pcg_setseq_8_rxs_m_xs_8_boundedrand_r(struct pcg_state_setseq_8* rng,
                                       uint8_t bound);
 
+extern inline uint8_t
+pcg_setseq_8_rxs_m_xs_8_boundedrand_mul_r(struct pcg_state_setseq_8* rng,
+                                          uint8_t bound);
+
+extern inline uint8_t
+pcg_setseq_8_rxs_m_xs_8_boundedrand_fixed_r(struct pcg_state_setseq_8* rng,
+                                            const struct pcg_bound_8* b);
+
+extern inline void
+pcg_setseq_8_rxs_m_xs_8_fill_r(struct pcg_state_setseq_8* rng, void* buf,
+                               size_t n);
+
 /* Generation functions for RXS M */
 
 /* Generation functions for XSL RR (only defined for "large" types) */
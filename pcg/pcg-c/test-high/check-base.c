@@ -87,13 +87,33 @@ int main(int argc, char** argv)
 
         printf("  Again:");
         XX_ADVANCE(-XX_NUMVALUES);
+#ifdef XX_FILL
+        /* Regenerate the same numbers with a single bulk fill */
+        XX_FILLDECL(values)
+        XX_FILL(values);
+        for (int i = 0; i < XX_NUMVALUES; ++i) {
+            if (i > 0 && i % XX_NUMWRAP == 0)
+               printf("\n\t");
+            XX_PRINT_RNGVAL(values[i]);
+        }
+#else
         for (int i = 0; i < XX_NUMVALUES; ++i) {
             if (i > 0 && i % XX_NUMWRAP == 0)
                printf("\n\t");
             XX_PRINT_RNGVAL(XX_RANDOM());
         }
+#endif
         printf("\n");
-        
+#ifdef XX_FILL
+        /* Check the fill against single draws, also where the output
+           goes to /dev/null */
+        XX_ADVANCE(-XX_NUMVALUES);
+        for (int i = 0; i < XX_NUMVALUES; ++i) {
+            if (XX_RANDOM() != values[i])
+                printf("Fill mismatch: value %d\n", i);
+        }
+#endif
+
         /* Toss some coins */
         printf("  Coins: ");
         for (int i = 0; i < 65; ++i)
@@ -134,5 +154,89 @@ int main(int argc, char** argv)
         printf("\n");
     }
 
+#ifdef XX_BOUNDEDRAND_MUL
+    /* The multiply-shift bounded functions must agree with each other
+       and with a plain reference from the same seed, and stay below the
+       bound.  Nothing is printed unless they don't. */
+    static const int bounds[] = {1, 2, 3, 6, 52, 100, 127, 128, 255};
+    for (int j = 0; j < (int) (sizeof(bounds) / sizeof(bounds[0])); ++j) {
+        XX_VALUEDECL(bound)
+        bound = bounds[j];
+        XX_FILLDECL(values)
+        XX_SRANDOM(XX_SRANDOM_SEEDCONSTS);
+        for (int i = 0; i < XX_NUMVALUES; ++i)
+            values[i] = XX_BOUNDEDRAND_MUL(bounds[j]);
+
+        XX_SRANDOM(XX_SRANDOM_SEEDCONSTS);
+        XX_BOUNDDECL(fixed, bounds[j])
+        for (int i = 0; i < XX_NUMVALUES; ++i) {
+            if (XX_BOUNDEDRAND_FIXED(fixed) != values[i]
+                || values[i] >= bound)
+                printf("Bounded mismatch: bound %d, value %d\n",
+                       bounds[j], i);
+        }
+
+        /* Reference without a double-width type: every bound is below
+           2^8, so the high half of x * bound is put together from
+           x >> 8 and x & 0xff.  A draw is rejected while the low half,
+           x * bound modulo 2^N, is below 2^N modulo bound. */
+        XX_SRANDOM(XX_SRANDOM_SEEDCONSTS);
+        for (int i = 0; i < XX_NUMVALUES; ++i) {
+            XX_VALUEDECL(x)
+            XX_VALUEDECL(low)
+            XX_VALUEDECL(threshold)
+            threshold = -bound;
+            threshold %= bound;
+            do {
+                x = XX_RANDOM();
+                low = x * bound;
+            } while (low < threshold);
+            x = ((x >> 8) * bound + ((x & 0xffu) * bound >> 8))
+                >> (8 * sizeof(x) - 8);
+            if (x != values[i])
+                printf("Bounded reference mismatch: bound %d, value %d\n",
+                       bounds[j], i);
+        }
+
+#ifdef XX_BOUNDEDRAND_FILL
+        /* A bounded fill keeps exactly the accepted draws, in order */
+        XX_FILLDECL(filled)
+        XX_SRANDOM(XX_SRANDOM_SEEDCONSTS);
+        XX_BOUNDEDRAND_FILL(bounds[j], filled);
+        for (int i = 0; i < XX_NUMVALUES; ++i) {
+            if (filled[i] != values[i])
+                printf("Bounded fill mismatch: bound %d, value %d\n",
+                       bounds[j], i);
+        }
+#endif
+    }
+#endif
+
+#ifdef XX_PARTITION
+    /* Worker k of a partition into blocks of 1000 must start where the
+       sequence stands after k blocks, whether the workers are handed out
+       in a batch or one by number.  Nothing is printed unless they
+       don't. */
+    {
+        XX_PARTITION_DECL(part, workers, one)
+        XX_SRANDOM(XX_SRANDOM_SEEDCONSTS);
+        XX_PARTITION(part, 1000u);
+        XX_PARTITION_FILL(part, 2u, workers);
+        XX_ADVANCE(2000u);
+        for (int k = 0; k < XX_NUMVALUES; ++k) {
+            XX_PARTITION_BLOCK(part, k + 2u, one);
+            XX_VALUEDECL(expected)
+            XX_VALUEDECL(batched)
+            XX_VALUEDECL(numbered)
+            expected = XX_RANDOM();
+            batched = XX_PARTITION_RANDOM(workers[k]);
+            numbered = XX_PARTITION_RANDOM(one);
+            if (batched != expected || numbered != expected)
+                printf("Partition mismatch: worker %d\n", k + 2);
+            XX_ADVANCE(999u);
+        }
+    }
+#endif
+
     return 0;
 }
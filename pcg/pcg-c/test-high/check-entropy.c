@@ -0,0 +1,152 @@
+/*
+ * PCG Random Number Generation for C.
+ *
+ * Copyright 2014-2017 Melissa O'Neill <oneill@pcg-random.org>,
+ *                     and the PCG Project contributors.
+ *
+ * SPDX-License-Identifier: (Apache-2.0 OR MIT)
+ *
+ * Licensed under the Apache License, Version 2.0 (provided in
+ * LICENSE-APACHE.txt and at http://www.apache.org/licenses/LICENSE-2.0)
+ * or under the MIT license (provided in LICENSE-MIT.txt and at
+ * http://opensource.org/licenses/MIT), at your option. This file may not
+ * be copied, modified, or distributed except according to those terms.
+ *
+ * Distributed on an "AS IS" BASIS, WITHOUT WARRANTY OF ANY KIND, either
+ * express or implied.  See your chosen license for details.
+ *
+ * For additional information about the PCG random number generation scheme,
+ * visit http://www.pcg-random.org/.
+ */
+
+/*
+ * Checks the entropy_getbytes pool: threads claiming slices at once must
+ * never be handed the same bytes, and nor must a forked child and its
+ * parent.
+ */
+
+#define _POSIX_C_SOURCE 200809L
+
+#include <stdio.h>
+#include <stddef.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+#include <pthread.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+#include "entropy.h"                    /* Wrapper around /dev/random */
+
+#define NUM_THREADS         8
+#define SLICES_PER_THREAD   20000
+#define SLICE_SIZE          16
+
+static unsigned char slices[NUM_THREADS][SLICES_PER_THREAD][SLICE_SIZE];
+
+static void* draw_slices(void* arg)
+{
+    unsigned char (*mine)[SLICE_SIZE] = arg;
+    for (int i = 0; i < SLICES_PER_THREAD; ++i)
+        if (!entropy_getbytes(mine[i], SLICE_SIZE))
+            return arg;
+    return NULL;
+}
+
+static int compare_slices(const void* a, const void* b)
+{
+    return memcmp(a, b, SLICE_SIZE);
+}
+
+static int check_threads(void)
+{
+    pthread_t threads[NUM_THREADS];
+    for (int t = 0; t < NUM_THREADS; ++t)
+        pthread_create(&threads[t], NULL, draw_slices, slices[t]);
+    int failed = 0;
+    for (int t = 0; t < NUM_THREADS; ++t) {
+        void* result;
+        pthread_join(threads[t], &result);
+        failed |= result != NULL;
+    }
+    if (failed) {
+        printf("entropy_getbytes failed in a thread\n");
+        return 1;
+    }
+
+    size_t count = (size_t) NUM_THREADS * SLICES_PER_THREAD;
+    qsort(slices, count, SLICE_SIZE, compare_slices);
+    size_t repeats = 0;
+    for (size_t i = 1; i < count; ++i)
+        repeats += memcmp(slices[0][i - 1], slices[0][i], SLICE_SIZE) == 0;
+    if (repeats > 0) {
+        printf("%zu repeated slices across threads\n", repeats);
+        return 1;
+    }
+    return 0;
+}
+
+static int check_fork(void)
+{
+    unsigned char parent[4][SLICE_SIZE], child[4][SLICE_SIZE];
+    int fds[2];
+
+    /* Leave the pool part used, so the child would repeat its rest */
+    if (!entropy_getbytes(parent[0], SLICE_SIZE) || pipe(fds) != 0) {
+        printf("could not set up the fork check\n");
+        return 1;
+    }
+    fflush(stdout);
+    pid_t pid = fork();
+    if (pid < 0) {
+        printf("fork failed\n");
+        return 1;
+    }
+    if (pid == 0) {
+        close(fds[0]);
+        bool ok = entropy_getbytes(child, sizeof(child));
+        ok = ok && write(fds[1], child, sizeof(child)) == sizeof(child);
+        _exit(ok ? 0 : 1);
+    }
+    close(fds[1]);
+    bool ok = true;
+    for (int i = 0; i < 4; ++i)
+        ok = ok && entropy_getbytes(parent[i], SLICE_SIZE);
+    ok = ok && read(fds[0], child, sizeof(child)) == sizeof(child);
+    close(fds[0]);
+    int status;
+    ok = waitpid(pid, &status, 0) == pid && ok
+         && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if (!ok) {
+        printf("could not draw bytes in the parent and child\n");
+        return 1;
+    }
+
+    int repeats = 0;
+    for (int i = 0; i < 4; ++i)
+        for (int j = 0; j < 4; ++j)
+            repeats += memcmp(parent[i], child[j], SLICE_SIZE) == 0;
+    if (repeats > 0) {
+        printf("%d slices repeated between parent and child\n", repeats);
+        return 1;
+    }
+    return 0;
+}
+
+int main(void)
+{
+    int failures = 0;
+
+    printf("entropy_getbytes:\n");
+    if (check_threads() == 0)
+        printf("  -  %d threads drew %d slices each, none repeated\n",
+               NUM_THREADS, SLICES_PER_THREAD);
+    else
+        ++failures;
+    if (check_fork() == 0)
+        printf("  -  a forked child drew different bytes from its parent\n");
+    else
+        ++failures;
+    return failures ? EXIT_FAILURE : EXIT_SUCCESS;
+}
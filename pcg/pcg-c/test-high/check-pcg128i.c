@@ -26,6 +26,16 @@
             pcg128i_random_r(&rng)
 #define XX_BOUNDEDRAND(bound)       \
             pcg128i_boundedrand_r(&rng, bound)
+#define XX_BOUNDEDRAND_MUL(bound)   \
+            pcg128i_boundedrand_mul_r(&rng, bound)
+#define XX_BOUNDDECL(b, bound)      \
+            struct pcg_bound_128 b; pcg_bound_128_init(&b, bound);
+#define XX_BOUNDEDRAND_FIXED(b)     \
+            pcg128i_boundedrand_fixed_r(&rng, &b)
+#define XX_FILLDECL(values)         pcg128_t values[XX_NUMVALUES];
+#define XX_VALUEDECL(value)         pcg128_t value;
+#define XX_FILL(values)             \
+            pcg128i_fill_r(&rng, values, XX_NUMVALUES)
 #define XX_ADVANCE(delta)           \
             pcg128i_advance_r(&rng, delta)
 
@@ -22,6 +22,16 @@
             pcg16i_random_r(&rng)
 #define XX_BOUNDEDRAND(bound)       \
             pcg16i_boundedrand_r(&rng, bound)
+#define XX_BOUNDEDRAND_MUL(bound)   \
+            pcg16i_boundedrand_mul_r(&rng, bound)
+#define XX_BOUNDDECL(b, bound)      \
+            struct pcg_bound_16 b; pcg_bound_16_init(&b, bound);
+#define XX_BOUNDEDRAND_FIXED(b)     \
+            pcg16i_boundedrand_fixed_r(&rng, &b)
+#define XX_FILLDECL(values)         uint16_t values[XX_NUMVALUES];
+#define XX_VALUEDECL(value)         uint16_t value;
+#define XX_FILL(values)             \
+            pcg16i_fill_r(&rng, values, XX_NUMVALUES)
 #define XX_ADVANCE(delta)           \
             pcg16i_advance_r(&rng, delta)
 
@@ -22,8 +22,31 @@
             pcg32_random_r(&rng)
 #define XX_BOUNDEDRAND(bound)       \
             pcg32_boundedrand_r(&rng, bound)
+#define XX_BOUNDEDRAND_MUL(bound)   \
+            pcg32_boundedrand_mul_r(&rng, bound)
+#define XX_BOUNDDECL(b, bound)      \
+            struct pcg_bound_32 b; pcg_bound_32_init(&b, bound);
+#define XX_BOUNDEDRAND_FIXED(b)     \
+            pcg32_boundedrand_fixed_r(&rng, &b)
+#define XX_BOUNDEDRAND_FILL(bound, values) \
+            pcg32_boundedrand_fill_r(&rng, bound, values, XX_NUMVALUES)
+#define XX_FILLDECL(values)         uint32_t values[XX_NUMVALUES];
+#define XX_VALUEDECL(value)         uint32_t value;
+#define XX_FILL(values)             \
+            pcg32_fill_r(&rng, values, XX_NUMVALUES)
 #define XX_ADVANCE(delta)           \
             pcg32_advance_r(&rng, delta)
+#define XX_PARTITION_DECL(part, workers, one) \
+            pcg32_partition_t part; \
+            pcg32_random_t workers[XX_NUMVALUES], one;
+#define XX_PARTITION(part, blocksize) \
+            pcg32_partition_r(&part, &rng, blocksize)
+#define XX_PARTITION_FILL(part, first, workers) \
+            pcg32_partition_fill_r(&part, first, workers, XX_NUMVALUES)
+#define XX_PARTITION_BLOCK(part, k, one) \
+            pcg32_partition_block_r(&part, k, &one)
+#define XX_PARTITION_RANDOM(worker) \
+            pcg32_random_r(&worker)
 
 #include "pcg_variants.h"
 #include "check-base.c"
@@ -22,6 +22,18 @@
             pcg32s_random_r(&rng)
 #define XX_BOUNDEDRAND(bound)       \
             pcg32s_boundedrand_r(&rng, bound)
+#define XX_BOUNDEDRAND_MUL(bound)   \
+            pcg32s_boundedrand_mul_r(&rng, bound)
+#define XX_BOUNDDECL(b, bound)      \
+            struct pcg_bound_32 b; pcg_bound_32_init(&b, bound);
+#define XX_BOUNDEDRAND_FIXED(b)     \
+            pcg32s_boundedrand_fixed_r(&rng, &b)
+#define XX_BOUNDEDRAND_FILL(bound, values) \
+            pcg32s_boundedrand_fill_r(&rng, bound, values, XX_NUMVALUES)
+#define XX_FILLDECL(values)         uint32_t values[XX_NUMVALUES];
+#define XX_VALUEDECL(value)         uint32_t value;
+#define XX_FILL(values)             \
+            pcg32s_fill_r(&rng, values, XX_NUMVALUES)
 #define XX_ADVANCE(delta)           \
             pcg32s_advance_r(&rng, delta)
 
@@ -22,8 +22,31 @@
             pcg64_random_r(&rng)
 #define XX_BOUNDEDRAND(bound)       \
             pcg64_boundedrand_r(&rng, bound)
+#define XX_BOUNDEDRAND_MUL(bound)   \
+            pcg64_boundedrand_mul_r(&rng, bound)
+#define XX_BOUNDDECL(b, bound)      \
+            struct pcg_bound_64 b; pcg_bound_64_init(&b, bound);
+#define XX_BOUNDEDRAND_FIXED(b)     \
+            pcg64_boundedrand_fixed_r(&rng, &b)
+#define XX_BOUNDEDRAND_FILL(bound, values) \
+            pcg64_boundedrand_fill_r(&rng, bound, values, XX_NUMVALUES)
+#define XX_FILLDECL(values)         uint64_t values[XX_NUMVALUES];
+#define XX_VALUEDECL(value)         uint64_t value;
+#define XX_FILL(values)             \
+            pcg64_fill_r(&rng, values, XX_NUMVALUES)
 #define XX_ADVANCE(delta)           \
             pcg64_advance_r(&rng, delta)
+#define XX_PARTITION_DECL(part, workers, one) \
+            pcg64_partition_t part; \
+            pcg64_random_t workers[XX_NUMVALUES], one;
+#define XX_PARTITION(part, blocksize) \
+            pcg64_partition_r(&part, &rng, blocksize)
+#define XX_PARTITION_FILL(part, first, workers) \
+            pcg64_partition_fill_r(&part, first, workers, XX_NUMVALUES)
+#define XX_PARTITION_BLOCK(part, k, one) \
+            pcg64_partition_block_r(&part, k, &one)
+#define XX_PARTITION_RANDOM(worker) \
+            pcg64_random_r(&worker)
 
 #include "pcg_variants.h"
 #if PCG_HAS_128BIT_OPS
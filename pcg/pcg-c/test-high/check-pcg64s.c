@@ -22,6 +22,18 @@
             pcg64s_random_r(&rng)
 #define XX_BOUNDEDRAND(bound)       \
             pcg64s_boundedrand_r(&rng, bound)
+#define XX_BOUNDEDRAND_MUL(bound)   \
+            pcg64s_boundedrand_mul_r(&rng, bound)
+#define XX_BOUNDDECL(b, bound)      \
+            struct pcg_bound_64 b; pcg_bound_64_init(&b, bound);
+#define XX_BOUNDEDRAND_FIXED(b)     \
+            pcg64s_boundedrand_fixed_r(&rng, &b)
+#define XX_BOUNDEDRAND_FILL(bound, values) \
+            pcg64s_boundedrand_fill_r(&rng, bound, values, XX_NUMVALUES)
+#define XX_FILLDECL(values)         uint64_t values[XX_NUMVALUES];
+#define XX_VALUEDECL(value)         uint64_t value;
+#define XX_FILL(values)             \
+            pcg64s_fill_r(&rng, values, XX_NUMVALUES)
 #define XX_ADVANCE(delta)           \
             pcg64s_advance_r(&rng, delta)
 
@@ -22,6 +22,16 @@
             pcg64si_random_r(&rng)
 #define XX_BOUNDEDRAND(bound)       \
             pcg64si_boundedrand_r(&rng, bound)
+#define XX_BOUNDEDRAND_MUL(bound)   \
+            pcg64si_boundedrand_mul_r(&rng, bound)
+#define XX_BOUNDDECL(b, bound)      \
+            struct pcg_bound_64 b; pcg_bound_64_init(&b, bound);
+#define XX_BOUNDEDRAND_FIXED(b)     \
+            pcg64si_boundedrand_fixed_r(&rng, &b)
+#define XX_FILLDECL(values)         uint64_t values[XX_NUMVALUES];
+#define XX_VALUEDECL(value)         uint64_t value;
+#define XX_FILL(values)             \
+            pcg64si_fill_r(&rng, values, XX_NUMVALUES)
 #define XX_ADVANCE(delta)           \
             pcg64si_advance_r(&rng, delta)
 
@@ -22,6 +22,16 @@
             pcg8si_random_r(&rng)
 #define XX_BOUNDEDRAND(bound)       \
             pcg8si_boundedrand_r(&rng, bound)
+#define XX_BOUNDEDRAND_MUL(bound)   \
+            pcg8si_boundedrand_mul_r(&rng, bound)
+#define XX_BOUNDDECL(b, bound)      \
+            struct pcg_bound_8 b; pcg_bound_8_init(&b, bound);
+#define XX_BOUNDEDRAND_FIXED(b)     \
+            pcg8si_boundedrand_fixed_r(&rng, &b)
+#define XX_FILLDECL(values)         uint8_t values[XX_NUMVALUES];
+#define XX_VALUEDECL(value)         uint8_t value;
+#define XX_FILL(values)             \
+            pcg8si_fill_r(&rng, values, XX_NUMVALUES)
 #define XX_ADVANCE(delta)           \
             pcg8si_advance_r(&rng, delta)
 
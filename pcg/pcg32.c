@@ -25,6 +25,7 @@
   */
 
 #include <stdlib.h>
+#include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
 #include <time.h>
@@ -48,12 +49,51 @@ uint32_t pcg32_random_r(pcg64_random_t *rng) {
 	return (shifted >> rot) | (shifted << ((-rot) & 31));
 }
 
+// Jump the LCG ahead by delta steps in O(log delta) multiplications,
+// Brown's algorithm as in pcg_advance_lcg_64() of pcg-c
+uint64_t pcg_advance_lcg_64(uint64_t state, uint64_t delta, uint64_t cur_mult, uint64_t cur_plus) {
+	uint64_t acc_mult = 1u;
+	uint64_t acc_plus = 0u;
+	while (delta > 0) {
+		if (delta & 1) {
+			acc_mult *= cur_mult;
+			acc_plus = acc_plus * cur_mult + cur_plus;
+		}
+		cur_plus = (cur_mult + 1) * cur_plus;
+		cur_mult *= cur_mult;
+		delta /= 2;
+	}
+	return acc_mult * state + acc_plus;
+}
+
+// Same state as stepping the generator by the low byte of initseq, and
+// then of initstate, without the data dependent loops
 void pcg32_srandom_r(pcg64_random_t *rng, uint64_t initstate, uint64_t initseq) {
 	rng->state = 0u;
 	rng->inc = (initseq << 1u) | 1u;
-	for (uint8_t i=initseq; i>0; --i) { (void)pcg32_random_r(rng); }
+	rng->state = pcg_advance_lcg_64(rng->state, (uint8_t)initseq, PCG_DEFAULT_MULTIPLIER_64, rng->inc);
 	rng->state += initstate;
-	for (uint8_t i=initstate; i>0; --i) { (void)pcg32_random_r(rng); }
+	rng->state = pcg_advance_lcg_64(rng->state, (uint8_t)initstate, PCG_DEFAULT_MULTIPLIER_64, rng->inc);
+}
+
+// Seed n generators, each as pcg32_srandom_r() would. Advances of up
+// to 255 steps are looked up as M^k and 1 + M + ... + M^(k-1), making
+// each context two multiply-adds.
+void pcg32_srandom_n(pcg64_random_t *rng, uint64_t const *initstate, uint64_t const *initseq, size_t n) {
+	uint64_t mult[256], plus[256];
+	mult[0] = 1u;
+	plus[0] = 0u;
+	for (int k=1; k<256; ++k) {
+		mult[k] = mult[k-1] * PCG_DEFAULT_MULTIPLIER_64;
+		plus[k] = plus[k-1] * PCG_DEFAULT_MULTIPLIER_64 + 1u;
+	}
+	for (size_t i=0; i<n; ++i) {
+		uint64_t const inc = (initseq[i] << 1u) | 1u;
+		uint8_t const a = initseq[i], b = initstate[i];
+		uint64_t const state = inc * plus[a] + initstate[i];
+		rng[i].state = state * mult[b] + inc * plus[b];
+		rng[i].inc = inc;
+	}
 }
 
 int main(int argc, char **argv) {
@@ -0,0 +1,538 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Reentrant versions of the pseudorandom number generators in prng.c.
+
+   Every generator keeps its state in an explicit context struct that
+   is passed to its *_next() function, the same way jsf.c passes
+   ranctx64_t to ranval64(). Any number of independent instances can
+   be used, e.g. one per thread, with no hidden global state.
+
+   Every generator also has a <name>_fill(ctx, buf, n) function that
+   writes n values straight into buf, which must be aligned for the
+   output type. The context is kept in locals for the whole loop, so
+   it stays in registers instead of being reloaded after each store.
+
+   PRNG_INIT_<name> holds the manually picked default seed of each
+   generator, and PRNG_LIST() lists them all with their output type
+   and context struct for building generator tables.
+ */
+
+#ifndef PRNG_H
+#define PRNG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+
+// Rotation function macros
+#define rot64(x,k) (((x) << (k))|((x) >> (64 - (k))))
+#define rot32(x,k) (((x) << (k))|((x) >> (32 - (k))))
+#define rot16(x,k) (((x) << (k))|((x) >> (16 - (k))))
+#define rot8(x,k) (((x) << (k))|((x) >> (8 - (k))))
+
+// Jump for the linear xoshiro and xoroshiro engines: poly holds the
+// coefficients of a jump polynomial over bits state bits, as 64-bit
+// words lowest first, and the states selected by its set bits while
+// stepping are summed into the jumped state. name##_step() is the
+// state transition of the engine.
+#define PRNG_DEFINE_JUMP(name, ctx, bits) \
+static inline void name##_jump_poly(ctx *rng, uint64_t const poly[]) { \
+	ctx j = {{ 0 }}; \
+	for (int i = 0; i < (bits); ++i) { \
+		if (poly[i / 64] >> (i % 64) & 1) { \
+			for (size_t w = 0; w < sizeof(j.s) / sizeof(j.s[0]); ++w) { j.s[w] ^= rng->s[w]; } \
+		} \
+		name##_step(rng); \
+	} \
+	*rng = j; \
+}
+
+
+// PCG family
+// https://www.pcg-random.org/download.html
+typedef struct { uint16_t state; uint16_t inc; } pcg8_t;
+typedef struct { uint16_t state; } pcg8_fast_t;
+typedef struct { uint32_t state; uint32_t inc; } pcg16_t;
+typedef struct { uint32_t state; } pcg16_fast_t;
+typedef struct { uint64_t state; uint64_t inc; } pcg32_t;
+typedef struct { uint64_t state; } pcg32_fast_t;
+
+// pcg_mcg_16_xsh_rr_8_random_r
+static inline uint8_t pcg8_next(pcg8_t *rng) {
+	uint16_t x = rng->state;
+	rng->state = rng->state * 12829U + (rng->inc|1);
+
+	uint16_t value = ((x >> 5U) ^ x) >> 5U;
+	uint32_t rot = x >> 13U;
+	return (value >> rot) | (value << ((- rot) & 7));
+}
+// pcg_mcg_16_xsh_rs_8_random_r
+static inline uint8_t pcg8_fast_next(pcg8_fast_t *rng) {
+	uint16_t x = rng->state;
+	rng->state = rng->state * 12829U;
+
+	return ((x >> 7U) ^ x) >> ((x >> 14U) + 3U);
+}
+// pcg_mcg_32_xsh_rr_16_random_r
+static inline uint16_t pcg16_next(pcg16_t *rng) {
+	uint32_t x = rng->state;
+	rng->state = rng->state * 747796405U + (rng->inc|1);
+
+	uint16_t value = ((x >> 10U) ^ x) >> 12U;
+	uint32_t rot = x >> 28U;
+	return (value >> rot) | (value << ((- rot) & 15));
+}
+// pcg_mcg_32_xsh_rs_16_random_r
+static inline uint16_t pcg16_fast_next(pcg16_fast_t *rng) {
+	uint32_t x = rng->state;
+	rng->state = rng->state * 747796405U + 1U;
+
+	return ((x >> 11U) ^ x) >> ((x >> 30U) + 11U);
+}
+// pcg_mcg_64_xsh_rr_32_random_r
+static inline uint32_t pcg32_next(pcg32_t *rng) {
+	uint64_t x = rng->state;
+	rng->state = x * 6364136223846793005ULL + (rng->inc|1);
+
+	uint32_t value = ((x >> 18U) ^ x) >> 27U;
+	uint32_t rot = x >> 59U;
+	return (value >> rot) | (value << ((- rot) & 31));
+}
+// pcg_mcg_64_xsh_rs_32_random_r
+static inline uint32_t pcg32_fast_next(pcg32_fast_t *rng) {
+	uint64_t x = rng->state;
+	rng->state = x * 6364136223846793005ULL;
+
+	return ((x >> 22U) ^ x) >> ((x >> 61U) + 22U);
+}
+
+
+// George Marsaglia's XORshift variants
+// https://en.wikipedia.org/wiki/Xorshift
+typedef struct { uint32_t a; } xorshift32_t;
+typedef struct { uint64_t a; } xorshift64_t;
+typedef struct { uint32_t a; uint32_t b; uint32_t c; uint32_t d; } xorshift128_t;
+
+static inline uint32_t xorshift32_next(xorshift32_t *rng) {
+	uint32_t x = rng->a;
+	x ^= x << 13;
+	x ^= x >> 17;
+	x ^= x << 5;
+	return rng->a = x;
+}
+static inline uint64_t xorshift64_next(xorshift64_t *rng) {
+	uint64_t x = rng->a;
+	x ^= x << 13;
+	x ^= x >> 7;
+	x ^= x << 17;
+	return rng->a = x;
+}
+static inline uint32_t xorshift128_next(xorshift128_t *rng) {
+	uint32_t t = rng->d;
+	uint32_t const s = rng->a;
+	rng->d = rng->c; rng->c = rng->b; rng->b = s;
+
+	t ^= t << 11;
+	t ^= t >> 8;
+	return rng->a = t ^ s ^ (s >> 19);
+}
+
+
+// https://prng.di.unimi.it/
+// Improved versions of George Marsaglia xorshift
+// General-purpose xoshiro 32-bit PRNG variants
+typedef struct { uint32_t s[4]; } xoshiro128_t;
+typedef struct { uint32_t s[2]; } xoroshiro64_t;
+
+// Shared xoshiro128 state transition
+static inline void xoshiro128_step(xoshiro128_t *rng) {
+	uint32_t *s = rng->s;
+	uint32_t const t = s[1] << 9;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+
+	s[2] ^= t;
+	s[3] = rot32(s[3], 11);
+}
+PRNG_DEFINE_JUMP(xoshiro128, xoshiro128_t, 128)
+// Advance by 2^64 steps, or by 2^96 steps for long_jump, with the
+// published 32-bit constants packed into 64-bit words
+static inline void xoshiro128_jump(xoshiro128_t *rng) {
+	static uint64_t const JUMP[] = { 0xf542d2d38764000b, 0x77f2db5b6fa035c3 };
+	xoshiro128_jump_poly(rng, JUMP);
+}
+static inline void xoshiro128_long_jump(xoshiro128_t *rng) {
+	static uint64_t const LONG_JUMP[] = { 0x0b6f099fb523952e, 0x1c580662ccf5a0ef };
+	xoshiro128_jump_poly(rng, LONG_JUMP);
+}
+// xoshiro128**
+static inline uint32_t xoshiro128ss_next(xoshiro128_t *rng) {
+	uint32_t const result = rot32(rng->s[1] * 5, 7) * 9;
+	xoshiro128_step(rng);
+	return result;
+}
+// xoshiro128++
+static inline uint32_t xoshiro128pp_next(xoshiro128_t *rng) {
+	uint32_t const result = rot32(rng->s[0] + rng->s[3], 7) + rng->s[0];
+	xoshiro128_step(rng);
+	return result;
+}
+// xoshiro128+ faster variant
+static inline uint32_t xoshiro128p_next(xoshiro128_t *rng) {
+	uint32_t const result = rng->s[0] + rng->s[3];
+	xoshiro128_step(rng);
+	return result;
+}
+
+// General-purpose xoroshiro 32-bit PRNG variants
+// Shared xoroshiro64 state transition
+static inline void xoroshiro64_step(xoroshiro64_t *rng) {
+	uint32_t const t0 = rng->s[0];
+	uint32_t t1 = rng->s[1];
+
+	t1 ^= t0;
+	rng->s[0] = rot32(t0, 26) ^ t1 ^ (t1 << 9); // a, b
+	rng->s[1] = rot32(t1, 13); // c
+}
+PRNG_DEFINE_JUMP(xoroshiro64, xoroshiro64_t, 64)
+// No published constants, these are x^(2^32) and x^(2^48) modulo the
+// characteristic polynomial in prng_jump.h
+static inline void xoroshiro64_jump(xoroshiro64_t *rng) {
+	static uint64_t const JUMP[] = { 0x4cbf99bd77fcd1a0 };
+	xoroshiro64_jump_poly(rng, JUMP);
+}
+static inline void xoroshiro64_long_jump(xoroshiro64_t *rng) {
+	static uint64_t const LONG_JUMP[] = { 0xb4e7e4633f1f8b95 };
+	xoroshiro64_jump_poly(rng, LONG_JUMP);
+}
+// xoroshiro64**
+static inline uint32_t xoroshiro64ss_next(xoroshiro64_t *rng) {
+	uint32_t const result = rot32(rng->s[0] * 0x03641019, 5) * 5;
+	xoroshiro64_step(rng);
+	return result;
+}
+// xoroshiro64* faster variant
+static inline uint32_t xoroshiro64s_next(xoroshiro64_t *rng) {
+	uint32_t const result = rng->s[0] * 0x589bb6ca;
+	xoroshiro64_step(rng);
+	return result;
+}
+
+// General-purpose xoshiro 64-bit PRNG variants
+typedef struct { uint64_t s[4]; } xoshiro256_t;
+typedef struct { uint64_t s[2]; } xoroshiro128_t;
+
+// Shared xoshiro256 state transition
+static inline void xoshiro256_step(xoshiro256_t *rng) {
+	uint64_t *s = rng->s;
+	uint64_t const t = s[1] << 17;
+
+	s[2] ^= s[0];
+	s[3] ^= s[1];
+	s[1] ^= s[2];
+	s[0] ^= s[3];
+
+	s[2] ^= t;
+	s[3] = rot64(s[3], 45);
+}
+// xoshiro256**
+static inline uint64_t xoshiro256ss_next(xoshiro256_t *rng) {
+	uint64_t const result = rot64(rng->s[1] * 5, 7) * 9;
+	xoshiro256_step(rng);
+	return result;
+}
+// xoshiro256++
+static inline uint64_t xoshiro256pp_next(xoshiro256_t *rng) {
+	uint64_t const result = rot64(rng->s[0] + rng->s[3], 23) + rng->s[0];
+	xoshiro256_step(rng);
+	return result;
+}
+// xoshiro256+ faster variant
+static inline uint64_t xoshiro256p_next(xoshiro256_t *rng) {
+	uint64_t const result = rng->s[0] + rng->s[3];
+	xoshiro256_step(rng);
+	return result;
+}
+
+// Advance xoshiro256 by 2^128 steps, giving 2^128 non-overlapping
+// subsequences for parallel use, or by 2^192 steps for long_jump
+PRNG_DEFINE_JUMP(xoshiro256, xoshiro256_t, 256)
+static inline void xoshiro256_jump(xoshiro256_t *rng) {
+	static uint64_t const JUMP[] = { 0x180ec6d33cfd0aba, 0xd5a61266f0c9392c, 0xa9582618e03fc9aa, 0x39abdc4529b1661c };
+	xoshiro256_jump_poly(rng, JUMP);
+}
+static inline void xoshiro256_long_jump(xoshiro256_t *rng) {
+	static uint64_t const LONG_JUMP[] = { 0x76e15d3efefdcbbf, 0xc5004e441c522fb3, 0x77710069854ee241, 0x39109bb02acbe635 };
+	xoshiro256_jump_poly(rng, LONG_JUMP);
+}
+
+// General-purpose xoroshiro 64-bit PRNG variants
+// xoroshiro128** and xoroshiro128+ share the same a, b, c constants
+static inline void xoroshiro128_step(xoroshiro128_t *rng) {
+	uint64_t const t0 = rng->s[0];
+	uint64_t t1 = rng->s[1];
+
+	t1 ^= t0;
+	rng->s[0] = rot64(t0, 24) ^ t1 ^ (t1 << 16); // a, b
+	rng->s[1] = rot64(t1, 37); // c
+}
+// xoroshiro128++ uses its own a, b, c constants
+static inline void xoroshiro128pp_step(xoroshiro128_t *rng) {
+	uint64_t const t0 = rng->s[0];
+	uint64_t t1 = rng->s[1];
+
+	t1 ^= t0;
+	rng->s[0] = rot64(t0, 49) ^ t1 ^ (t1 << 21); // a, b
+	rng->s[1] = rot64(t1, 28); // c
+}
+// Advance by 2^64 steps, or by 2^96 steps for long_jump, with the
+// constants of whichever step function the variant uses
+PRNG_DEFINE_JUMP(xoroshiro128, xoroshiro128_t, 128)
+PRNG_DEFINE_JUMP(xoroshiro128pp, xoroshiro128_t, 128)
+static inline void xoroshiro128_jump(xoroshiro128_t *rng) {
+	static uint64_t const JUMP[] = { 0xdf900294d8f554a5, 0x170865df4b3201fc };
+	xoroshiro128_jump_poly(rng, JUMP);
+}
+static inline void xoroshiro128_long_jump(xoroshiro128_t *rng) {
+	static uint64_t const LONG_JUMP[] = { 0xd2a98b26625eee7b, 0xdddf9b1090aa7ac1 };
+	xoroshiro128_jump_poly(rng, LONG_JUMP);
+}
+static inline void xoroshiro128pp_jump(xoroshiro128_t *rng) {
+	static uint64_t const JUMP[] = { 0x2bd7a6a6e99c2ddc, 0x0992ccaf6a6fca05 };
+	xoroshiro128pp_jump_poly(rng, JUMP);
+}
+static inline void xoroshiro128pp_long_jump(xoroshiro128_t *rng) {
+	static uint64_t const LONG_JUMP[] = { 0x360fd5f2cf8d5d99, 0x9c6e6877736c46e3 };
+	xoroshiro128pp_jump_poly(rng, LONG_JUMP);
+}
+// xoroshiro128**
+static inline uint64_t xoroshiro128ss_next(xoroshiro128_t *rng) {
+	uint64_t const result = rot64(rng->s[0] * 5, 7) * 9;
+	xoroshiro128_step(rng);
+	return result;
+}
+// xoroshiro128++
+static inline uint64_t xoroshiro128pp_next(xoroshiro128_t *rng) {
+	uint64_t const result = rot64(rng->s[0] + rng->s[1], 17) + rng->s[0];
+	xoroshiro128pp_step(rng);
+	return result;
+}
+// xoroshiro128+ faster variant
+static inline uint64_t xoroshiro128p_next(xoroshiro128_t *rng) {
+	uint64_t const result = rng->s[0] + rng->s[1];
+	xoroshiro128_step(rng);
+	return result;
+}
+
+
+// Brad Forschinger's XORshift
+// http://b2d-f9r.blogspot.com/2010/08/16-bit-xorshift-rng-now-with-more.html
+typedef struct { uint16_t x; uint16_t y; } brad16_t;
+
+static inline uint16_t brad16_next(brad16_t *rng) {
+	uint16_t t = (rng->x ^ (rng->x << 5));
+	rng->x = rng->y;
+	return rng->y = (rng->y ^ (rng->y >> 13)) ^ (t ^ (t >> 3));
+}
+
+
+// @tzarc's 8 bit XORshift, produces minor repeated pattern
+// https://github.com/tzarc/qmk_build/blob/bebe5e5b21e99bdb8ff41500ade1eac2d8417d8c/users-tzarc/tzarc_common.c#L57-L63
+typedef struct { uint8_t s; uint8_t a; } tzarc_prng_t;
+
+static inline uint8_t tzarc_prng_next(tzarc_prng_t *rng) {
+	rng->s ^= rng->s << 3;
+	rng->s ^= rng->s >> 5;
+	rng->s ^= rng->a++ >> 2;
+	return rng->s;
+}
+
+
+// Simple 4-register 8 bit XORshift
+// https://github.com/edrosten/8bit_rng
+typedef struct { uint8_t x; uint8_t y; uint8_t z; uint8_t a; } xshift8_t;
+
+static inline uint8_t xshift8_next(xshift8_t *rng) {
+	uint8_t t = rng->x ^ (rng->x << 5);
+	rng->x = rng->y; rng->y = rng->z; rng->z = rng->a;
+	return rng->a = rng->z ^ (rng->z >> 1) ^ t ^ (t << 3);
+}
+
+
+// Bob Jenkins Small Fast chaotic PRNG
+// http://burtleburtle.net/bob/rand/smallprng.html
+typedef struct { uint64_t a; uint64_t b; uint64_t c; uint64_t d; } jsf64_t;
+typedef struct { uint32_t a; uint32_t b; uint32_t c; uint32_t d; } jsf32_t;
+typedef struct { uint16_t a; uint16_t b; uint16_t c; uint16_t d; } jsf16_t;
+typedef struct { uint8_t a; uint8_t b; uint8_t c; uint8_t d; } jsf8_t;
+typedef struct { uint8_t a; uint8_t b; uint8_t c; } jsfsmall_t;
+typedef struct { uint8_t a; uint8_t b; } jsftiny_t;
+
+// Warm-up rounds after seeding, as raninit() in jsf.c
+#define RANINIT_ROUNDS 20
+
+static inline uint64_t jsf64_next(jsf64_t *x) {
+	uint64_t e = x->a - rot64(x->b, 7);
+	x->a = x->b ^ rot64(x->c, 13);
+	x->b = x->c + rot64(x->d, 37);
+	x->c = x->d + e;
+	return x->d = e + x->a;
+}
+static inline uint32_t jsf32_next(jsf32_t *x) {
+	uint32_t e = x->a - rot32(x->b, 27);
+	x->a = x->b ^ rot32(x->c, 17);
+	x->b = x->c + x->d;
+	x->c = x->d + e;
+	return x->d = e + x->a;
+}
+// https://www.pcg-random.org/posts/bob-jenkins-small-prng-passes-practrand.html
+static inline uint16_t jsf16_next(jsf16_t *x) {
+	uint16_t e = x->a - rot16(x->b, 13);
+	x->a = x->b ^ rot16(x->c, 8);
+	x->b = x->c + x->d;
+	x->c = x->d + e;
+	return x->d = e + x->a;
+}
+static inline uint8_t jsf8_next(jsf8_t *x) {
+	uint8_t e = x->a - rot8(x->b, 1);
+	x->a = x->b ^ rot8(x->c, 4);
+	x->b = x->c + x->d;
+	x->c = x->d + e;
+	return x->d = e + x->a;
+}
+static inline uint8_t jsfsmall_next(jsfsmall_t *x) {
+	uint8_t e = x->a - rot8(x->b, 1);
+	x->a = x->b ^ rot8(x->c, 4);
+	x->b = x->c + e;
+	return x->c = e + x->a;
+}
+static inline uint8_t jsftiny_next(jsftiny_t *x) {
+	uint8_t c = x->a - rot8(x->b, 1);
+	x->a = x->b ^ rot8(c, 4);
+	return x->b = c + x->a;
+}
+
+
+// Default seeds, picked manually
+#define PRNG_INIT_pcg8           { 0x9af1, 0x0527 }
+#define PRNG_INIT_pcg8_fast      { 0x1091 }
+#define PRNG_INIT_pcg16          { 0xdc384d8b, 0xbb7dc6ee }
+#define PRNG_INIT_pcg16_fast     { 0x8fe2b20f }
+#define PRNG_INIT_pcg32          { 0x385230e79de99aa9, 0xaffa9d760680f66d }
+#define PRNG_INIT_pcg32_fast     { 0x2c13ae4bbe60e39d }
+#define PRNG_INIT_xorshift32     { 0xe326df69 }
+#define PRNG_INIT_xorshift64     { 0xa87bf8a757164547 }
+#define PRNG_INIT_xorshift128    { 0xd2b9a87b, 0xec2cf2be, 0xdc317cfe, 0x350ad9e0 }
+#define PRNG_INIT_xoshiro128ss   {{ 0x6fe7bc01, 0x964fdc0a, 0xff50ac5b, 0x252d2a75 }}
+#define PRNG_INIT_xoshiro128pp   {{ 0x0ceda153, 0xb0bc8889, 0x83f6c7bf, 0x83fe4c65 }}
+#define PRNG_INIT_xoshiro128p    {{ 0x576d09dd, 0x55f240a1, 0xe8f90408, 0xa831286c }}
+#define PRNG_INIT_xoroshiro64ss  {{ 0x5b7fc314, 0xf704b0c6 }}
+#define PRNG_INIT_xoroshiro64s   {{ 0x7016abff, 0x05d1f7c9 }}
+#define PRNG_INIT_xoshiro256ss   {{ 0x6f79f27c453f5ce2, 0x2d4f4c8f8a6b81a9, 0x9a7773469eb18730, 0x3a282a6cb9086b8f }}
+#define PRNG_INIT_xoshiro256pp   {{ 0xe7e6f39e3fe6d812, 0xfe353a4f68cba671, 0x036d46d664128f31, 0x03772003383c1451 }}
+#define PRNG_INIT_xoshiro256p    {{ 0x14cd16b6e9df9e27, 0x7831374fca4ed8df, 0x685824bdf7c9dfb9, 0x29264c08627194c1 }}
+#define PRNG_INIT_xoroshiro128ss {{ 0x116c50456520ca17, 0x004a6c88da91336d }}
+#define PRNG_INIT_xoroshiro128pp {{ 0xf5b0ac38761054b4, 0x2413e73067774b0d }}
+#define PRNG_INIT_xoroshiro128p  {{ 0x305e0bc4831f6240, 0x7cff19974aef796d }}
+#define PRNG_INIT_brad16         { 1, 1 }
+#define PRNG_INIT_tzarc_prng     { 0xAA, 0 }
+#define PRNG_INIT_xshift8        { 0, 0, 0, 1 }
+#define PRNG_INIT_jsf8           { 0x9d, 0x78, 0x78, 0x78 }
+#define PRNG_INIT_jsf16          { 0xf5ae, 0x290c, 0x290c, 0x290c }
+#define PRNG_INIT_jsf32          { 0x596fece3, 0x3028b6ad, 0x3028b6ad, 0x3028b6ad }
+#define PRNG_INIT_jsf64          { 0xd336dca32b3f3250, 0x0c4ce13cca51e105, 0x0c4ce13cca51e105, 0x0c4ce13cca51e105 }
+#define PRNG_INIT_jsfsmall       { 0x9d, 0x78, 0x78 }
+#define PRNG_INIT_jsftiny        { 0x9d, 0x78 }
+
+
+// Generator list with output type and context struct of each PRNG
+#define PRNG_LIST(X) \
+	X(pcg8, uint8_t, pcg8_t) \
+	X(pcg8_fast, uint8_t, pcg8_fast_t) \
+	X(pcg16, uint16_t, pcg16_t) \
+	X(pcg16_fast, uint16_t, pcg16_fast_t) \
+	X(pcg32, uint32_t, pcg32_t) \
+	X(pcg32_fast, uint32_t, pcg32_fast_t) \
+	X(xorshift32, uint32_t, xorshift32_t) \
+	X(xorshift64, uint64_t, xorshift64_t) \
+	X(xorshift128, uint32_t, xorshift128_t) \
+	X(xoshiro128ss, uint32_t, xoshiro128_t) \
+	X(xoshiro128pp, uint32_t, xoshiro128_t) \
+	X(xoshiro128p, uint32_t, xoshiro128_t) \
+	X(xoroshiro64ss, uint32_t, xoroshiro64_t) \
+	X(xoroshiro64s, uint32_t, xoroshiro64_t) \
+	X(xoshiro256ss, uint64_t, xoshiro256_t) \
+	X(xoshiro256pp, uint64_t, xoshiro256_t) \
+	X(xoshiro256p, uint64_t, xoshiro256_t) \
+	X(xoroshiro128ss, uint64_t, xoroshiro128_t) \
+	X(xoroshiro128pp, uint64_t, xoroshiro128_t) \
+	X(xoroshiro128p, uint64_t, xoroshiro128_t) \
+	X(brad16, uint16_t, brad16_t) \
+	X(tzarc_prng, uint8_t, tzarc_prng_t) \
+	X(xshift8, uint8_t, xshift8_t) \
+	X(jsf8, uint8_t, jsf8_t) \
+	X(jsf16, uint16_t, jsf16_t) \
+	X(jsf32, uint32_t, jsf32_t) \
+	X(jsf64, uint64_t, jsf64_t) \
+	X(jsfsmall, uint8_t, jsfsmall_t) \
+	X(jsftiny, uint8_t, jsftiny_t)
+
+
+// Bulk fill functions, <name>_fill(ctx, buf, n) for every generator
+#define PRNG_DEFINE_FILL(name, type, ctx) \
+static inline void name##_fill(ctx *rng, void *buf, size_t n) { \
+	ctx x = *rng; \
+	type *out = buf; \
+	for (size_t i = 0; i < n; ++i) { out[i] = name##_next(&x); } \
+	*rng = x; \
+}
+PRNG_LIST(PRNG_DEFINE_FILL)
+
+// Bounded fill for the xoshiro family, n values in [0, bound) from
+// Lemire's multiply-shift reduction. The threshold is worked out once
+// per call, and every value is stored with the output index advanced
+// only when it is accepted, so rejections cost no branch and no call.
+// Accepted values keep their order, so the result and the generator
+// state are the same as drawing each value on its own with rejection.
+#define PRNG_DEFINE_BOUNDED_FILL(name, type, ctx, wide) \
+static inline void name##_boundedrand_fill(ctx *rng, type bound, type *out, size_t n) { \
+	type const threshold = (type)-bound % bound; \
+	ctx x = *rng; \
+	size_t i = 0; \
+	while (i < n) { \
+		wide const p = (wide)name##_next(&x) * bound; \
+		out[i] = (type)(p >> (8 * sizeof(type))); \
+		i += (type)p >= threshold; \
+	} \
+	*rng = x; \
+}
+PRNG_DEFINE_BOUNDED_FILL(xoshiro128ss, uint32_t, xoshiro128_t, uint64_t)
+PRNG_DEFINE_BOUNDED_FILL(xoshiro128pp, uint32_t, xoshiro128_t, uint64_t)
+PRNG_DEFINE_BOUNDED_FILL(xoshiro128p, uint32_t, xoshiro128_t, uint64_t)
+PRNG_DEFINE_BOUNDED_FILL(xoroshiro64ss, uint32_t, xoroshiro64_t, uint64_t)
+PRNG_DEFINE_BOUNDED_FILL(xoroshiro64s, uint32_t, xoroshiro64_t, uint64_t)
+PRNG_DEFINE_BOUNDED_FILL(xoshiro256ss, uint64_t, xoshiro256_t, __uint128_t)
+PRNG_DEFINE_BOUNDED_FILL(xoshiro256pp, uint64_t, xoshiro256_t, __uint128_t)
+PRNG_DEFINE_BOUNDED_FILL(xoshiro256p, uint64_t, xoshiro256_t, __uint128_t)
+PRNG_DEFINE_BOUNDED_FILL(xoroshiro128ss, uint64_t, xoroshiro128_t, __uint128_t)
+PRNG_DEFINE_BOUNDED_FILL(xoroshiro128pp, uint64_t, xoroshiro128_t, __uint128_t)
+PRNG_DEFINE_BOUNDED_FILL(xoroshiro128p, uint64_t, xoroshiro128_t, __uint128_t)
+
+#endif // PRNG_H
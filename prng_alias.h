@@ -0,0 +1,149 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Weighted discrete sampling by Vose's alias method.
+
+   prng_alias_init() builds the table from n weights in O(n): every
+   entry i keeps itself with probability prob[i] / 2^32 and otherwise
+   gives way to alias[i]. The two are held as separate 32-bit arrays
+   in one allocation, 8 bytes per outcome.
+
+   <name>_alias_sample() spends one 64-bit word per sample. The high 32
+   bits pick the entry by multiply-shift and the low 32 bits are the
+   coin. The rare words for which 2^32 is not a multiple of n are
+   rejected, so the index is exact. <name>_alias_fill() writes samples
+   in bulk. It draws a block of indices ahead and prefetches their
+   entries, and picks between entry and alias without a branch.
+
+   Defined for xoshiro256pp and xoshiro256ss, and for pcg64 when
+   pcg_variants.h was included first.
+ */
+
+#ifndef PRNG_ALIAS_H
+#define PRNG_ALIAS_H
+
+#include <float.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#include "prng.h"
+
+typedef struct {
+	uint32_t *prob;
+	uint32_t *alias;
+	uint32_t n;
+	uint32_t threshold;
+} prng_alias_t;
+
+static inline void prng_alias_free(prng_alias_t *t) {
+	free(t->prob);
+	t->prob = t->alias = NULL;
+	t->n = 0;
+}
+
+// Weights must be finite and non-negative with a positive sum; returns
+// -1 for bad weights or no memory, leaving the table empty
+static inline int prng_alias_init(prng_alias_t *t, double const *weights, size_t n) {
+	double sum = 0;
+	t->prob = t->alias = NULL;
+	t->n = 0;
+	if (n == 0 || n > UINT32_MAX) { return -1; }
+	for (size_t i = 0; i < n; ++i) {
+		if (!(weights[i] >= 0 && weights[i] <= DBL_MAX)) { return -1; }
+		sum += weights[i];
+	}
+	if (!(sum > 0 && sum <= DBL_MAX)) { return -1; }
+
+	double *p = malloc(n * sizeof(p[0]));
+	uint32_t *work = malloc(n * sizeof(work[0]));
+	uint32_t *table = malloc(2 * n * sizeof(table[0]));
+	if (!p || !work || !table) { free(p); free(work); free(table); return -1; }
+	t->prob = table;
+	t->alias = table + n;
+
+	// Scaled weights average 1. The small ones are stacked from the
+	// front of work and the large ones from the back, and every small
+	// entry is topped up from a large one, which gives back the excess.
+	size_t small = 0, large = n;
+	for (size_t i = 0; i < n; ++i) {
+		p[i] = weights[i] / sum * n;
+		if (p[i] < 1) { work[small++] = i; } else { work[--large] = i; }
+	}
+	while (small && large < n) {
+		uint32_t const s = work[--small];
+		uint32_t const g = work[large];
+		t->prob[s] = p[s] * 0x1.0p32;
+		t->alias[s] = g;
+		p[g] = (p[g] + p[s]) - 1;
+		if (p[g] < 1) { ++large; work[small++] = g; }
+	}
+	// What is left is 1 up to rounding, and keeps itself either way
+	while (small) { uint32_t const i = work[--small]; t->prob[i] = UINT32_MAX; t->alias[i] = i; }
+	while (large < n) { uint32_t const i = work[large++]; t->prob[i] = UINT32_MAX; t->alias[i] = i; }
+
+	free(p);
+	free(work);
+	t->n = n;
+	t->threshold = -(uint32_t)n % (uint32_t)n;
+	return 0;
+}
+
+// Samples drawn ahead of the table lookups in a fill
+#define PRNG_ALIAS_BLOCK 32
+
+// Words whose low 32 bits of high * n fall under the threshold are the
+// 2^32 mod n that would bias the index
+#define PRNG_DEFINE_ALIAS(name, ctx, next) \
+static inline uint32_t name##_alias_index(ctx *rng, prng_alias_t const *t, uint32_t *coin) { \
+	uint64_t r, m; \
+	do { \
+		r = next(rng); \
+		m = (r >> 32) * t->n; \
+	} while ((uint32_t)m < t->threshold); \
+	*coin = r; \
+	return m >> 32; \
+} \
+static inline uint32_t name##_alias_sample(ctx *rng, prng_alias_t const *t) { \
+	uint32_t coin; \
+	uint32_t const i = name##_alias_index(rng, t, &coin); \
+	return coin < t->prob[i] ? i : t->alias[i]; \
+} \
+/* Draws a block ahead and prefetches, as large tables miss the cache */ \
+static inline void name##_alias_fill(ctx *rng, prng_alias_t const *t, uint32_t *out, size_t n) { \
+	uint32_t idx[PRNG_ALIAS_BLOCK], coin[PRNG_ALIAS_BLOCK]; \
+	ctx x = *rng; \
+	for (size_t i = 0; i < n; i += PRNG_ALIAS_BLOCK) { \
+		size_t const c = n - i < PRNG_ALIAS_BLOCK ? n - i : PRNG_ALIAS_BLOCK; \
+		for (size_t j = 0; j < c; ++j) { \
+			idx[j] = name##_alias_index(&x, t, coin + j); \
+			__builtin_prefetch(t->prob + idx[j]); \
+			__builtin_prefetch(t->alias + idx[j]); \
+		} \
+		for (size_t j = 0; j < c; ++j) { \
+			out[i + j] = coin[j] < t->prob[idx[j]] ? idx[j] : t->alias[idx[j]]; \
+		} \
+	} \
+	*rng = x; \
+}
+PRNG_DEFINE_ALIAS(xoshiro256pp, xoshiro256_t, xoshiro256pp_next)
+PRNG_DEFINE_ALIAS(xoshiro256ss, xoshiro256_t, xoshiro256ss_next)
+
+#if defined(PCG_VARIANTS_H_INCLUDED) && PCG_HAS_128BIT_OPS
+PRNG_DEFINE_ALIAS(pcg64, pcg64_random_t, pcg64_random_r)
+#endif
+
+#endif // PRNG_ALIAS_H
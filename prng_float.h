@@ -0,0 +1,183 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Uniform floating-point output in [0, 1) from the 64-bit generators.
+
+   <name>_fill_double01() turns each 64-bit word into a double with its
+   53 high bits, (x >> 11) * 2^-53, and <name>_fill_float01() turns each
+   32-bit half of a word, in memory order, into a float with its 24 high
+   bits, (x >> 8) * 2^-24. Raw words are drawn a block at a time into a
+   buffer on the stack and converted from there into the output, so it
+   only needs the alignment of its own type, by an AVX2 kernel picked
+   at runtime or a scalar loop giving bit-identical results.
+
+   The *_dense() variants can return every representable value in
+   [0, 1), each with probability equal to its distance to the next one,
+   down to the subnormals. The mantissa comes from the low bits of the
+   word and the exponent from the run of zero bits above it, counted
+   from the top, and a word is only drawn for the exponent alone once in
+   4096 doubles or 2^41 floats. The + generators are weakest in their
+   lowest bits, so those only ever set the last bits of the mantissa,
+   as they do in the uniform fills, and never the exponent.
+
+   Defined for xoshiro256p and xoroshiro128p, the + variants meant for
+   floating point, and for pcg64 when pcg_variants.h was included first.
+ */
+
+#ifndef PRNG_FLOAT_H
+#define PRNG_FLOAT_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "prng_simd.h"
+
+// Scalar conversions; in and out may be the same array
+static inline void prng_double01_scalar(double *out, uint64_t const *in, size_t n) {
+	for (size_t i = 0; i < n; ++i) {
+		uint64_t x;
+		memcpy(&x, in + i, sizeof(x));
+		out[i] = (double)(x >> 11) * 0x1.0p-53;
+	}
+}
+static inline void prng_float01_scalar(float *out, uint32_t const *in, size_t n) {
+	for (size_t i = 0; i < n; ++i) {
+		uint32_t x;
+		memcpy(&x, in + i, sizeof(x));
+		out[i] = (float)(x >> 8) * 0x1.0p-24f;
+	}
+}
+
+#if PRNG_SIMD_X86
+// AVX2 has no 64-bit integer to double conversion. The high 52 bits
+// become the mantissa of a double in [1, 2), 1 is taken off exactly,
+// and bit 11 adds the last 2^-53.
+static __attribute__((target("avx2"))) void prng_double01_avx2(double *out, uint64_t const *in, size_t n) {
+	__m256i const one = _mm256_set1_epi64x(0x3ff0000000000000);
+	__m256i const bit = _mm256_set1_epi64x(1 << 11);
+	__m256d const ulp = _mm256_set1_pd(0x1.0p-53);
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i const x = _mm256_loadu_si256((__m256i const*)(in + i));
+		__m256d d = _mm256_castsi256_pd(_mm256_or_si256(_mm256_srli_epi64(x, 12), one));
+		__m256i const low = _mm256_cmpeq_epi64(_mm256_and_si256(x, bit), bit);
+		d = _mm256_sub_pd(d, _mm256_set1_pd(1.0));
+		d = _mm256_add_pd(d, _mm256_and_pd(_mm256_castsi256_pd(low), ulp));
+		_mm256_storeu_pd(out + i, d);
+	}
+	prng_double01_scalar(out + i, in + i, n - i);
+}
+// 24-bit values fit a signed int, so the conversion is exact
+static __attribute__((target("avx2"))) void prng_float01_avx2(float *out, uint32_t const *in, size_t n) {
+	__m256 const scale = _mm256_set1_ps(0x1.0p-24f);
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m256i const x = _mm256_loadu_si256((__m256i const*)(in + i));
+		_mm256_storeu_ps(out + i, _mm256_mul_ps(_mm256_cvtepi32_ps(_mm256_srli_epi32(x, 8)), scale));
+	}
+	prng_float01_scalar(out + i, in + i, n - i);
+}
+#endif
+
+static inline void prng_double01(double *out, uint64_t const *in, size_t n) {
+#if PRNG_SIMD_X86
+	if (PRNG_HAS_AVX2()) { prng_double01_avx2(out, in, n); return; }
+#endif
+	prng_double01_scalar(out, in, n);
+}
+static inline void prng_float01(float *out, uint32_t const *in, size_t n) {
+#if PRNG_SIMD_X86
+	if (PRNG_HAS_AVX2()) { prng_float01_avx2(out, in, n); return; }
+#endif
+	prng_float01_scalar(out, in, n);
+}
+
+// Exponent for the dense variants: start just below 1 and step down
+// once for every leading zero bit, from the width spare high bits of
+// the first word and then from as many further words as it takes; 0 is
+// the subnormal range
+#define PRNG_DENSE_EXPONENT(e, spare, width, next, rng) \
+	if (spare) { e -= __builtin_clzll(spare); } \
+	else { \
+		e -= width; \
+		for (;;) { \
+			uint64_t const y = next(rng); \
+			if (y) { e -= __builtin_clzll(y); break; } \
+			e -= 64; \
+			if (e <= 0) { break; } \
+		} \
+	} \
+	if (e < 0) { e = 0; }
+
+// Raw words per block for the uniform fills
+#define PRNG_FLOAT_BLOCK 256
+
+#define PRNG_DEFINE_FLOAT01(name, ctx, next, fill) \
+static inline void name##_fill_double01(ctx *rng, double *out, size_t n) { \
+	uint64_t block[PRNG_FLOAT_BLOCK]; \
+	for (size_t i = 0; i < n; i += PRNG_FLOAT_BLOCK) { \
+		size_t const m = n - i < PRNG_FLOAT_BLOCK ? n - i : PRNG_FLOAT_BLOCK; \
+		fill(rng, block, m); \
+		prng_double01(out + i, block, m); \
+	} \
+} \
+static inline void name##_fill_float01(ctx *rng, float *out, size_t n) { \
+	uint64_t block[PRNG_FLOAT_BLOCK]; \
+	for (size_t i = 0; i < n; i += 2 * PRNG_FLOAT_BLOCK) { \
+		size_t const m = n - i < 2 * PRNG_FLOAT_BLOCK ? n - i : 2 * PRNG_FLOAT_BLOCK; \
+		fill(rng, block, (m + 1) / 2); \
+		prng_float01(out + i, (uint32_t const*)block, m); \
+	} \
+} \
+static inline double name##_double01_dense(ctx *rng) { \
+	uint64_t const x = next(rng); \
+	uint64_t const spare = x & ~(uint64_t)0xfffffffffffff; \
+	int e = 1022; \
+	PRNG_DENSE_EXPONENT(e, spare, 12, next, rng) \
+	uint64_t const bits = (uint64_t)e << 52 | (x & 0xfffffffffffff); \
+	double d; \
+	memcpy(&d, &bits, sizeof(d)); \
+	return d; \
+} \
+static inline float name##_float01_dense(ctx *rng) { \
+	uint64_t const x = next(rng); \
+	uint64_t const spare = x & ~(uint64_t)0x7fffff; \
+	int e = 126; \
+	PRNG_DENSE_EXPONENT(e, spare, 41, next, rng) \
+	uint32_t const bits = (uint32_t)e << 23 | (uint32_t)(x & 0x7fffff); \
+	float f; \
+	memcpy(&f, &bits, sizeof(f)); \
+	return f; \
+} \
+static inline void name##_fill_double01_dense(ctx *rng, double *out, size_t n) { \
+	ctx x = *rng; \
+	for (size_t i = 0; i < n; ++i) { out[i] = name##_double01_dense(&x); } \
+	*rng = x; \
+} \
+static inline void name##_fill_float01_dense(ctx *rng, float *out, size_t n) { \
+	ctx x = *rng; \
+	for (size_t i = 0; i < n; ++i) { out[i] = name##_float01_dense(&x); } \
+	*rng = x; \
+}
+PRNG_DEFINE_FLOAT01(xoshiro256p, xoshiro256_t, xoshiro256p_next, xoshiro256p_fill)
+PRNG_DEFINE_FLOAT01(xoroshiro128p, xoroshiro128_t, xoroshiro128p_next, xoroshiro128p_fill)
+
+#if defined(PCG_VARIANTS_H_INCLUDED) && PCG_HAS_128BIT_OPS
+PRNG_DEFINE_FLOAT01(pcg64, pcg64_random_t, pcg64_random_r, pcg64_fill_r)
+#endif
+
+#endif // PRNG_FLOAT_H
@@ -0,0 +1,138 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Arbitrary-distance jumps and cached jump tables for the xoshiro and
+   xoroshiro engines in prng.h.
+
+   The state transition of each engine is linear over GF(2), so moving
+   ahead by d steps is multiplying the state by M^d. By Cayley-Hamilton
+   M^d equals J(M) where J(x) = x^d mod P(x) and P is the characteristic
+   polynomial of M. <name>_jump_by() builds J by square-and-multiply on
+   P and hands it to <name>_jump_poly(), the same routine that applies
+   the published jump constants.
+
+   Each jump still steps the engine once per state bit. To hand out
+   streams to many workers, <name>_jumptable_init() expands one jump
+   into its matrix, stored as the XOR of every 4-bit group of input
+   bits. <name>_jumptable_apply() then jumps with one table lookup per
+   nibble of state, and <name>_streams() spaces n contexts one jump
+   apart in O(n).
+ */
+
+#ifndef PRNG_JUMP_H
+#define PRNG_JUMP_H
+
+#include <string.h>
+#include "prng.h"
+
+// Characteristic polynomials of the state transitions, lowest
+// coefficient first with the leading x^bits term implied. Obtained with
+// Berlekamp-Massey on one state bit over 2*bits steps, and checked by
+// reproducing every published jump and long jump constant as x^(2^k)
+// mod P(x).
+static uint64_t const PRNG_CHARPOLY_xoshiro128[] = { 0x1b489db6de18fc01, 0x00fc65a2006254b1 };
+static uint64_t const PRNG_CHARPOLY_xoroshiro64[] = { 0x053be9da6e2286c1 };
+static uint64_t const PRNG_CHARPOLY_xoshiro256[] = {
+	0x9d116f2bb0f0f001, 0x0280002bcefd1a5e, 0x04b4edcf26259f85, 0x0003c03c3f3ecb19 };
+static uint64_t const PRNG_CHARPOLY_xoroshiro128[] = { 0x095b8f76579aa001, 0x0008828e513b43d5 };
+static uint64_t const PRNG_CHARPOLY_xoroshiro128pp[] = { 0x8dae70779760b081, 0x0031bcf2f855d6e5 };
+
+// Largest state handled, in 64-bit words
+#define PRNG_JUMP_WORDS 4
+
+// r = a * b mod P over GF(2), all of them bits wide; r may alias a or b
+static inline void prng_gf2_mulmod(uint64_t r[], uint64_t const a[], uint64_t const b[], uint64_t const P[], int bits) {
+	int const words = bits / 64;
+	uint64_t acc[PRNG_JUMP_WORDS] = { 0 };
+
+	for (int i = bits - 1; i >= 0; --i) {
+		// acc *= x, folding the x^bits term back in with P
+		uint64_t const top = acc[words - 1] >> 63;
+		for (int w = words - 1; w > 0; --w) { acc[w] = acc[w] << 1 | acc[w - 1] >> 63; }
+		acc[0] <<= 1;
+		if (top) { for (int w = 0; w < words; ++w) { acc[w] ^= P[w]; } }
+		if (b[i / 64] >> (i % 64) & 1) { for (int w = 0; w < words; ++w) { acc[w] ^= a[w]; } }
+	}
+	memcpy(r, acc, words * sizeof(acc[0]));
+}
+
+// poly = x^distance mod P, distance given as bits / 64 words lowest first
+static inline void prng_jump_polynomial(uint64_t poly[], uint64_t const distance[], uint64_t const P[], int bits) {
+	uint64_t x[PRNG_JUMP_WORDS] = { 2 };
+	int const words = bits / 64;
+
+	memset(poly, 0, words * sizeof(poly[0]));
+	poly[0] = 1;
+	for (int i = bits - 1; i >= 0; --i) {
+		prng_gf2_mulmod(poly, poly, poly, P, bits);
+		if (distance[i / 64] >> (i % 64) & 1) { prng_gf2_mulmod(poly, poly, x, P, bits); }
+	}
+}
+
+// Each table row holds the jumped image of all 16 values of one state
+// nibble, so a jump is the XOR of one entry per nibble
+typedef struct { uint64_t t[PRNG_JUMP_WORDS * 16][16][PRNG_JUMP_WORDS]; } prng_jumptable_t;
+
+#define PRNG_DEFINE_JUMP_TABLE(name, ctx, bits) \
+static inline void name##_jump_by(ctx *rng, uint64_t const distance[]) { \
+	uint64_t poly[PRNG_JUMP_WORDS]; \
+	prng_jump_polynomial(poly, distance, PRNG_CHARPOLY_##name, (bits)); \
+	name##_jump_poly(rng, poly); \
+} \
+static inline void name##_jumptable_init(prng_jumptable_t *table, uint64_t const poly[]) { \
+	for (int p = 0; p < (bits) / 4; ++p) { \
+		memset(table->t[p][0], 0, sizeof(table->t[p][0])); \
+		for (int b = 0; b < 4; ++b) { \
+			uint64_t w[PRNG_JUMP_WORDS] = { 0 }; \
+			ctx x; \
+			w[p / 16] = (uint64_t)1 << (p % 16 * 4 + b); \
+			memcpy(x.s, w, sizeof(x.s)); \
+			name##_jump_poly(&x, poly); \
+			memset(table->t[p][1 << b], 0, sizeof(table->t[p][0])); \
+			memcpy(table->t[p][1 << b], x.s, sizeof(x.s)); \
+		} \
+		for (int v = 3; v < 16; ++v) { \
+			if ((v & (v - 1)) == 0) { continue; } \
+			for (int k = 0; k < PRNG_JUMP_WORDS; ++k) { \
+				table->t[p][v][k] = table->t[p][v & (v - 1)][k] ^ table->t[p][v & -v][k]; \
+			} \
+		} \
+	} \
+} \
+static inline void name##_jumptable_apply(ctx *rng, prng_jumptable_t const *table) { \
+	uint64_t w[PRNG_JUMP_WORDS] = { 0 }; \
+	uint64_t j[PRNG_JUMP_WORDS] = { 0 }; \
+	memcpy(w, rng->s, sizeof(rng->s)); \
+	for (int p = 0; p < (bits) / 4; ++p) { \
+		uint64_t const *e = table->t[p][w[p / 16] >> (p % 16 * 4) & 15]; \
+		for (int k = 0; k < (bits) / 64; ++k) { j[k] ^= e[k]; } \
+	} \
+	memcpy(rng->s, j, sizeof(rng->s)); \
+} \
+static inline void name##_streams(ctx const *seed, ctx out[], size_t n, prng_jumptable_t const *table) { \
+	ctx x = *seed; \
+	for (size_t i = 0; i < n; ++i) { \
+		out[i] = x; \
+		name##_jumptable_apply(&x, table); \
+	} \
+}
+PRNG_DEFINE_JUMP_TABLE(xoshiro128, xoshiro128_t, 128)
+PRNG_DEFINE_JUMP_TABLE(xoroshiro64, xoroshiro64_t, 64)
+PRNG_DEFINE_JUMP_TABLE(xoshiro256, xoshiro256_t, 256)
+PRNG_DEFINE_JUMP_TABLE(xoroshiro128, xoroshiro128_t, 128)
+PRNG_DEFINE_JUMP_TABLE(xoroshiro128pp, xoroshiro128_t, 128)
+
+#endif // PRNG_JUMP_H
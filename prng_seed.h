@@ -0,0 +1,216 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Deterministic bulk seeding from one 64-bit master seed.
+
+   Word k of the seed sequence is output k of SplitMix64 started at the
+   master seed, mix(seed + (k + 1) * golden gamma), so any word can be
+   computed on its own. Generator i takes words i * W to i * W + W - 1,
+   W being its state size in words, and so gets the same state however
+   many generators are seeded and in what order.
+
+   prng_seed_words() writes a run of the sequence with an AVX-512DQ,
+   AVX2 or scalar kernel picked at runtime, with the same results from
+   each. <name>_seed_n() seeds n contexts of a generator in blocks: the
+   raw words are written straight into the array, then each state is
+   fixed up while still in cache, making it valid for the generator:
+   nonzero for the xorshift families, odd for multiplicative pcg, and
+   the usual 0xf1ea5eed start and 20 round warm-up for jsf, and both
+   nonzero and warmed up for jsfsmall and jsftiny, whose all-zero state
+   would only ever output zero.
+
+   Defined for every generator in PRNG_LIST, and for pcg32_random and
+   pcg64 from pcg_variants.h when it was included first, seeded with
+   their srandom_r() from the raw words.
+ */
+
+#ifndef PRNG_SEED_H
+#define PRNG_SEED_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "prng_simd.h"
+
+#define PRNG_SEED_GAMMA 0x9e3779b97f4a7c15
+
+// Contexts seeded and fixed up per pass
+#define PRNG_SEED_BLOCK 64
+
+static inline uint64_t prng_seed_mix(uint64_t z) {
+	z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9;
+	z = (z ^ (z >> 27)) * 0x94d049bb133111eb;
+	return z ^ (z >> 31);
+}
+
+// Word k of the sequence for seed
+static inline uint64_t prng_seed_word(uint64_t seed, uint64_t k) {
+	return prng_seed_mix(seed + (k + 1) * PRNG_SEED_GAMMA);
+}
+
+static inline void prng_seed_words_scalar(uint64_t seed, uint64_t first, void *out, size_t n) {
+	unsigned char *p = out;
+	for (size_t i = 0; i < n; ++i) {
+		uint64_t const w = prng_seed_word(seed, first + i);
+		memcpy(p + 8 * i, &w, sizeof(w));
+	}
+}
+
+#if PRNG_SIMD_X86
+// AVX2 multiplies 32-bit halves only, so the low 64 bits of the
+// product are lo * lo plus the two cross terms shifted up
+static inline __attribute__((target("avx2"))) __m256i prng_seed_mullo_avx2(__m256i a, __m256i b) {
+	__m256i const cross = _mm256_add_epi64(
+		_mm256_mul_epu32(_mm256_srli_epi64(a, 32), b), _mm256_mul_epu32(a, _mm256_srli_epi64(b, 32)));
+	return _mm256_add_epi64(_mm256_mul_epu32(a, b), _mm256_slli_epi64(cross, 32));
+}
+static __attribute__((target("avx2"))) void prng_seed_words_avx2(uint64_t seed, uint64_t first, void *out, size_t n) {
+	__m256i const m1 = _mm256_set1_epi64x(0xbf58476d1ce4e5b9);
+	__m256i const m2 = _mm256_set1_epi64x(0x94d049bb133111eb);
+	__m256i const step = _mm256_set1_epi64x(4 * PRNG_SEED_GAMMA);
+	uint64_t const z0 = seed + (first + 1) * PRNG_SEED_GAMMA;
+	__m256i z = _mm256_setr_epi64x(z0, z0 + PRNG_SEED_GAMMA, z0 + 2 * PRNG_SEED_GAMMA, z0 + 3 * PRNG_SEED_GAMMA);
+	unsigned char *p = out;
+	size_t i = 0;
+	for (; i + 4 <= n; i += 4) {
+		__m256i x = z;
+		x = prng_seed_mullo_avx2(_mm256_xor_si256(x, _mm256_srli_epi64(x, 30)), m1);
+		x = prng_seed_mullo_avx2(_mm256_xor_si256(x, _mm256_srli_epi64(x, 27)), m2);
+		x = _mm256_xor_si256(x, _mm256_srli_epi64(x, 31));
+		_mm256_storeu_si256((__m256i*)(p + 8 * i), x);
+		z = _mm256_add_epi64(z, step);
+	}
+	prng_seed_words_scalar(seed, first + i, p + 8 * i, n - i);
+}
+static __attribute__((target("avx512f,avx512dq"))) void prng_seed_words_avx512(uint64_t seed, uint64_t first, void *out, size_t n) {
+	__m512i const m1 = _mm512_set1_epi64(0xbf58476d1ce4e5b9);
+	__m512i const m2 = _mm512_set1_epi64(0x94d049bb133111eb);
+	__m512i const step = _mm512_set1_epi64(8 * PRNG_SEED_GAMMA);
+	__m512i z = _mm512_add_epi64(
+		_mm512_set1_epi64(seed + (first + 1) * PRNG_SEED_GAMMA),
+		_mm512_mullo_epi64(_mm512_setr_epi64(0, 1, 2, 3, 4, 5, 6, 7), _mm512_set1_epi64(PRNG_SEED_GAMMA)));
+	unsigned char *p = out;
+	size_t i = 0;
+	for (; i + 8 <= n; i += 8) {
+		__m512i x = z;
+		x = _mm512_mullo_epi64(_mm512_xor_si512(x, _mm512_srli_epi64(x, 30)), m1);
+		x = _mm512_mullo_epi64(_mm512_xor_si512(x, _mm512_srli_epi64(x, 27)), m2);
+		x = _mm512_xor_si512(x, _mm512_srli_epi64(x, 31));
+		_mm512_storeu_si512(p + 8 * i, x);
+		z = _mm512_add_epi64(z, step);
+	}
+	prng_seed_words_scalar(seed, first + i, p + 8 * i, n - i);
+}
+#endif
+
+// Words first to first + n - 1 of the sequence for seed, into any memory
+static inline void prng_seed_words(uint64_t seed, uint64_t first, void *out, size_t n) {
+#if PRNG_SIMD_X86
+	if (PRNG_HAS_AVX512DQ()) { prng_seed_words_avx512(seed, first, out, n); return; }
+	if (PRNG_HAS_AVX2()) { prng_seed_words_avx2(seed, first, out, n); return; }
+#endif
+	prng_seed_words_scalar(seed, first, out, n);
+}
+
+static inline void prng_seed_nonzero(void *x, size_t size) {
+	unsigned char *p = x;
+	unsigned char any = 0;
+	for (size_t i = 0; i < size; ++i) { any |= p[i]; }
+	if (!any) { p[0] = 1; }
+}
+
+// State fix-ups, <name>_seed_fix() for each generator
+#define PRNG_SEED_KEEP(name, ctx) \
+static inline void name##_seed_fix(ctx *x) { (void)x; }
+#define PRNG_SEED_NONZERO(name, ctx) \
+static inline void name##_seed_fix(ctx *x) { prng_seed_nonzero(x, sizeof(*x)); }
+#define PRNG_SEED_ODD(name, ctx) \
+static inline void name##_seed_fix(ctx *x) { x->state |= 1; }
+#define PRNG_SEED_WARM_NONZERO(name, ctx) \
+static inline void name##_seed_fix(ctx *x) { \
+	prng_seed_nonzero(x, sizeof(*x)); \
+	for (int i = 0; i < RANINIT_ROUNDS; ++i) { (void)name##_next(x); } \
+}
+#define PRNG_SEED_JSF(name, ctx) \
+static inline void name##_seed_fix(ctx *x) { \
+	x->a = (__typeof__(x->a))0xf1ea5eed; \
+	x->c = x->d = x->b; \
+	for (int i = 0; i < RANINIT_ROUNDS; ++i) { (void)name##_next(x); } \
+}
+PRNG_SEED_KEEP(pcg8, pcg8_t)
+PRNG_SEED_ODD(pcg8_fast, pcg8_fast_t)
+PRNG_SEED_KEEP(pcg16, pcg16_t)
+PRNG_SEED_KEEP(pcg16_fast, pcg16_fast_t)
+PRNG_SEED_KEEP(pcg32, pcg32_t)
+PRNG_SEED_ODD(pcg32_fast, pcg32_fast_t)
+PRNG_SEED_NONZERO(xorshift32, xorshift32_t)
+PRNG_SEED_NONZERO(xorshift64, xorshift64_t)
+PRNG_SEED_NONZERO(xorshift128, xorshift128_t)
+PRNG_SEED_NONZERO(xoshiro128ss, xoshiro128_t)
+PRNG_SEED_NONZERO(xoshiro128pp, xoshiro128_t)
+PRNG_SEED_NONZERO(xoshiro128p, xoshiro128_t)
+PRNG_SEED_NONZERO(xoroshiro64ss, xoroshiro64_t)
+PRNG_SEED_NONZERO(xoroshiro64s, xoroshiro64_t)
+PRNG_SEED_NONZERO(xoshiro256ss, xoshiro256_t)
+PRNG_SEED_NONZERO(xoshiro256pp, xoshiro256_t)
+PRNG_SEED_NONZERO(xoshiro256p, xoshiro256_t)
+PRNG_SEED_NONZERO(xoroshiro128ss, xoroshiro128_t)
+PRNG_SEED_NONZERO(xoroshiro128pp, xoroshiro128_t)
+PRNG_SEED_NONZERO(xoroshiro128p, xoroshiro128_t)
+PRNG_SEED_NONZERO(brad16, brad16_t)
+PRNG_SEED_KEEP(tzarc_prng, tzarc_prng_t)
+PRNG_SEED_NONZERO(xshift8, xshift8_t)
+PRNG_SEED_JSF(jsf8, jsf8_t)
+PRNG_SEED_JSF(jsf16, jsf16_t)
+PRNG_SEED_JSF(jsf32, jsf32_t)
+PRNG_SEED_JSF(jsf64, jsf64_t)
+PRNG_SEED_WARM_NONZERO(jsfsmall, jsfsmall_t)
+PRNG_SEED_WARM_NONZERO(jsftiny, jsftiny_t)
+
+// Contexts first to first + n - 1 of the sequence for seed. Whole-word
+// states take one bulk pass per block; smaller ones are cut from the
+// leading bytes of their own word.
+#define PRNG_DEFINE_SEED(name, ctx) \
+static inline void name##_seed_n(ctx out[], size_t n, uint64_t seed, uint64_t first) { \
+	size_t const words = (sizeof(ctx) + 7) / 8; \
+	for (size_t i = 0; i < n; i += PRNG_SEED_BLOCK) { \
+		size_t const c = n - i < PRNG_SEED_BLOCK ? n - i : PRNG_SEED_BLOCK; \
+		if (sizeof(ctx) % 8 == 0) { \
+			prng_seed_words(seed, (first + i) * words, out + i, c * words); \
+		} else { \
+			for (size_t j = 0; j < c; ++j) { \
+				uint64_t w[(sizeof(ctx) + 7) / 8]; \
+				prng_seed_words_scalar(seed, (first + i + j) * words, w, words); \
+				memcpy(out + i + j, w, sizeof(ctx)); \
+			} \
+		} \
+		for (size_t j = 0; j < c; ++j) { name##_seed_fix(out + i + j); } \
+	} \
+}
+#define PRNG_DEFINE_SEED_LIST(name, type, ctx) PRNG_DEFINE_SEED(name, ctx)
+PRNG_LIST(PRNG_DEFINE_SEED_LIST)
+
+#ifdef PCG_VARIANTS_H_INCLUDED
+static inline void pcg32_random_seed_fix(pcg32_random_t *x) { pcg32_srandom_r(x, x->state, x->inc); }
+PRNG_DEFINE_SEED(pcg32_random, pcg32_random_t)
+#if PCG_HAS_128BIT_OPS
+static inline void pcg64_seed_fix(pcg64_random_t *x) { pcg64_srandom_r(x, x->state, x->inc); }
+PRNG_DEFINE_SEED(pcg64, pcg64_random_t)
+#endif
+#endif
+
+#endif // PRNG_SEED_H
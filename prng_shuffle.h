@@ -0,0 +1,264 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Shuffles and random samples from batched bounded draws.
+
+   Fisher-Yates needs a value in [0, b) for every bound b from n down to
+   2. While b <= 2^32, <name>_bounded_pair() takes the values for b and
+   b - 1 from a single 64-bit word, the batched method of Brackett-
+   Rozinsky and Lemire: the word is multiplied by b, and what is left
+   below the top 64 bits is multiplied by b - 1. The pair is uniform
+   once leftovers under 2^64 mod b(b - 1) are rejected, which is rare
+   and the only time a division is done.
+
+   <name>_shuffle32() and <name>_shuffle64() permute an array in place,
+   and <name>_partial_shuffle32() and 64() stop after k steps, leaving a
+   uniform k-of-n sample in random order at the front. Swap targets are
+   drawn a block ahead and prefetched, as on large arrays nearly every
+   swap is a cache miss. <name>_reservoir_add32() and 64() keep a uniform
+   sample of k from a stream fed in chunks of any size (Algorithm R).
+
+   With PRNG_SHUFFLE_THREADS defined before inclusion, and -pthread,
+   <name>_shuffle32_parallel() and 64() shuffle across threads with the
+   method of Rao and Sandelius: each element goes to a random bucket,
+   then every bucket is shuffled on its own. Buckets are sized to stay
+   in cache, and each thread draws from its own jump of the generator,
+   so the result depends on the seed and the thread count only.
+
+   Defined for xoshiro256pp and xoshiro256ss, and for pcg64 when
+   pcg_variants.h was included first.
+ */
+
+#ifndef PRNG_SHUFFLE_H
+#define PRNG_SHUFFLE_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "prng.h"
+
+#ifdef PRNG_SHUFFLE_THREADS
+#include <pthread.h>
+#endif
+
+// Swap targets drawn ahead of the swaps
+#define PRNG_SHUFFLE_BLOCK 16
+
+// Below this many elements the parallel shuffle runs serially, and
+// above it buckets hold about 2^PRNG_SHUFFLE_BUCKET_BITS elements
+#define PRNG_SHUFFLE_MIN_PARALLEL (1 << 20)
+#define PRNG_SHUFFLE_BUCKET_BITS 16
+
+#define PRNG_DEFINE_BOUNDED_PAIR(name, ctx, next) \
+static inline uint64_t name##_bounded64(ctx *rng, uint64_t bound) { \
+	__uint128_t m = (__uint128_t)next(rng) * bound; \
+	if ((uint64_t)m < bound) { \
+		uint64_t const t = -bound % bound; \
+		while ((uint64_t)m < t) { m = (__uint128_t)next(rng) * bound; } \
+	} \
+	return m >> 64; \
+} \
+/* Values in [0, a) and [0, b) for a * b < 2^64 */ \
+static inline void name##_bounded_pair(ctx *rng, uint64_t a, uint64_t b, uint64_t *ra, uint64_t *rb) { \
+	uint64_t const prod = a * b; \
+	__uint128_t m = (__uint128_t)next(rng) * a; \
+	*ra = m >> 64; \
+	m = (__uint128_t)(uint64_t)m * b; \
+	*rb = m >> 64; \
+	if ((uint64_t)m < prod) { \
+		uint64_t const t = -prod % prod; \
+		while ((uint64_t)m < t) { \
+			m = (__uint128_t)next(rng) * a; \
+			*ra = m >> 64; \
+			m = (__uint128_t)(uint64_t)m * b; \
+			*rb = m >> 64; \
+		} \
+	} \
+} \
+/* r[k] in [0, bound - k) for k < c, pairs while the bound allows */ \
+static inline void name##_bounded_down(ctx *rng, uint64_t bound, uint64_t r[], size_t c) { \
+	for (size_t k = 0; k < c;) { \
+		uint64_t const b = bound - k; \
+		if (k + 1 < c && b <= (uint64_t)1 << 32) { \
+			name##_bounded_pair(rng, b, b - 1, r + k, r + k + 1); \
+			k += 2; \
+		} else { \
+			r[k++] = name##_bounded64(rng, b); \
+		} \
+	} \
+}
+
+#define PRNG_DEFINE_SHUFFLE(name, ctx, bits) \
+static inline void name##_partial_shuffle##bits(ctx *rng, uint##bits##_t *a, size_t n, size_t k) { \
+	uint64_t r[2][PRNG_SHUFFLE_BLOCK]; \
+	ctx x = *rng; \
+	if (k > n) { k = n; } \
+	size_t c = k < PRNG_SHUFFLE_BLOCK ? k : PRNG_SHUFFLE_BLOCK; \
+	name##_bounded_down(&x, n, r[0], c); \
+	for (size_t j = 0; j < c; ++j) { __builtin_prefetch(a + j + r[0][j], 1); } \
+	for (size_t i = 0, cur = 0; i < k; cur ^= 1) { \
+		size_t const c2 = k - i - c < PRNG_SHUFFLE_BLOCK ? k - i - c : PRNG_SHUFFLE_BLOCK; \
+		name##_bounded_down(&x, n - i - c, r[cur ^ 1], c2); \
+		for (size_t j = 0; j < c2; ++j) { __builtin_prefetch(a + i + c + j + r[cur ^ 1][j], 1); } \
+		for (size_t j = 0; j < c; ++j) { \
+			uint##bits##_t const t = a[i + j]; \
+			a[i + j] = a[i + j + r[cur][j]]; \
+			a[i + j + r[cur][j]] = t; \
+		} \
+		i += c; \
+		c = c2; \
+	} \
+	*rng = x; \
+} \
+static inline void name##_shuffle##bits(ctx *rng, uint##bits##_t *a, size_t n) { \
+	name##_partial_shuffle##bits(rng, a, n, n ? n - 1 : 0); \
+} \
+typedef struct { uint##bits##_t *sample; size_t k; uint64_t seen; } name##_reservoir##bits##_t; \
+static inline void name##_reservoir_add##bits(ctx *rng, name##_reservoir##bits##_t *res, uint##bits##_t const *in, size_t m) { \
+	ctx x = *rng; \
+	size_t i = 0; \
+	for (; i < m && res->seen < res->k; ++i) { res->sample[res->seen++] = in[i]; } \
+	for (; i + 1 < m && res->seen + 2 <= (uint64_t)1 << 32; i += 2) { \
+		uint64_t ra, rb; \
+		name##_bounded_pair(&x, res->seen + 1, res->seen + 2, &ra, &rb); \
+		if (ra < res->k) { res->sample[ra] = in[i]; } \
+		if (rb < res->k) { res->sample[rb] = in[i + 1]; } \
+		res->seen += 2; \
+	} \
+	for (; i < m; ++i) { \
+		uint64_t const r = name##_bounded64(&x, ++res->seen); \
+		if (r < res->k) { res->sample[r] = in[i]; } \
+	} \
+	*rng = x; \
+} \
+PRNG_DEFINE_SHUFFLE_PARALLEL(name, ctx, bits)
+
+#ifdef PRNG_SHUFFLE_THREADS
+// One job per thread. Bucket labels are lb-bit fields of the words;
+// the scatter redraws them from the same starting state as the count.
+// Buckets are assigned to threads round robin, copied back into place
+// and shuffled there while still in cache.
+#define PRNG_DEFINE_SHUFFLE_PARALLEL(name, ctx, bits) \
+typedef struct { \
+	ctx rng; \
+	uint##bits##_t *a, *scratch; \
+	size_t lo, hi, *pos, *start; \
+	unsigned id, threads, lb, phase; \
+} name##_shuffle##bits##_job_t; \
+static void *name##_shuffle##bits##_worker(void *arg) { \
+	name##_shuffle##bits##_job_t *job = arg; \
+	size_t const buckets = (size_t)1 << job->lb; \
+	if (job->phase < 2) { \
+		ctx x = job->rng; \
+		uint64_t w = 0; \
+		unsigned left = 0; \
+		for (size_t i = job->lo; i < job->hi; ++i) { \
+			if (!left) { w = name##_next(&x); left = 64 / job->lb; } \
+			size_t const b = w & (buckets - 1); \
+			w >>= job->lb; \
+			--left; \
+			if (job->phase == 0) { ++job->pos[b]; } \
+			else { job->scratch[job->pos[b]++] = job->a[i]; } \
+		} \
+		if (job->phase == 1) { job->rng = x; } \
+		return NULL; \
+	} \
+	for (size_t b = job->id; b < buckets; b += job->threads) { \
+		size_t const n = job->start[b + 1] - job->start[b]; \
+		memcpy(job->a + job->start[b], job->scratch + job->start[b], n * sizeof(job->a[0])); \
+		name##_shuffle##bits(&job->rng, job->a + job->start[b], n); \
+	} \
+	return NULL; \
+} \
+static inline void name##_shuffle##bits##_phase(name##_shuffle##bits##_job_t *jobs, unsigned threads, unsigned phase) { \
+	pthread_t tid[threads]; \
+	int started[threads]; \
+	for (unsigned t = 0; t < threads; ++t) { \
+		jobs[t].phase = phase; \
+		started[t] = t && pthread_create(&tid[t], NULL, name##_shuffle##bits##_worker, &jobs[t]) == 0; \
+	} \
+	for (unsigned t = 0; t < threads; ++t) { \
+		if (started[t]) { pthread_join(tid[t], NULL); } \
+		else { name##_shuffle##bits##_worker(&jobs[t]); } \
+	} \
+} \
+/* scratch holds n elements; falls back to the serial shuffle when */ \
+/* the array is small or memory runs out */ \
+static inline void name##_shuffle##bits##_parallel(ctx *rng, uint##bits##_t *a, size_t n, uint##bits##_t *scratch, unsigned threads) { \
+	unsigned lb = 1; \
+	while (lb < 16 && (((size_t)1 << lb) < threads || n >> lb > (size_t)1 << PRNG_SHUFFLE_BUCKET_BITS)) { ++lb; } \
+	size_t const buckets = (size_t)1 << lb; \
+	name##_shuffle##bits##_job_t *jobs = NULL; \
+	size_t *counts = NULL, *start = NULL; \
+	if (threads > 1 && n >= PRNG_SHUFFLE_MIN_PARALLEL) { \
+		jobs = malloc(threads * sizeof(jobs[0])); \
+		counts = calloc((size_t)threads * buckets, sizeof(counts[0])); \
+		start = malloc((buckets + 1) * sizeof(start[0])); \
+	} \
+	if (!jobs || !counts || !start) { \
+		free(jobs); free(counts); free(start); \
+		name##_shuffle##bits(rng, a, n); \
+		return; \
+	} \
+	for (unsigned t = 0; t < threads; ++t) { \
+		name##_shuffle##bits##_job_t const job = { \
+			*rng, a, scratch, n / threads * t, t + 1 < threads ? n / threads * (t + 1) : n, \
+			counts + (size_t)t * buckets, start, t, threads, lb, 0 }; \
+		jobs[t] = job; \
+		name##_split(rng); \
+	} \
+	name##_shuffle##bits##_phase(jobs, threads, 0); \
+	size_t sum = 0; \
+	for (size_t b = 0; b < buckets; ++b) { \
+		start[b] = sum; \
+		for (unsigned t = 0; t < threads; ++t) { \
+			size_t const c = jobs[t].pos[b]; \
+			jobs[t].pos[b] = sum; \
+			sum += c; \
+		} \
+	} \
+	start[buckets] = sum; \
+	name##_shuffle##bits##_phase(jobs, threads, 1); \
+	name##_shuffle##bits##_phase(jobs, threads, 2); \
+	free(jobs); free(counts); free(start); \
+}
+#else
+#define PRNG_DEFINE_SHUFFLE_PARALLEL(name, ctx, bits)
+#endif
+
+// Thread streams are one jump apart
+static inline void xoshiro256pp_split(xoshiro256_t *rng) { xoshiro256_jump(rng); }
+static inline void xoshiro256ss_split(xoshiro256_t *rng) { xoshiro256_jump(rng); }
+
+PRNG_DEFINE_BOUNDED_PAIR(xoshiro256pp, xoshiro256_t, xoshiro256pp_next)
+PRNG_DEFINE_SHUFFLE(xoshiro256pp, xoshiro256_t, 32)
+PRNG_DEFINE_SHUFFLE(xoshiro256pp, xoshiro256_t, 64)
+PRNG_DEFINE_BOUNDED_PAIR(xoshiro256ss, xoshiro256_t, xoshiro256ss_next)
+PRNG_DEFINE_SHUFFLE(xoshiro256ss, xoshiro256_t, 32)
+PRNG_DEFINE_SHUFFLE(xoshiro256ss, xoshiro256_t, 64)
+
+#if defined(PCG_VARIANTS_H_INCLUDED) && PCG_HAS_128BIT_OPS
+static inline uint64_t pcg64_next(pcg64_random_t *rng) { return pcg64_random_r(rng); }
+static inline void pcg64_split(pcg64_random_t *rng) { pcg64_advance_r(rng, (pcg128_t)1 << 64); }
+
+PRNG_DEFINE_BOUNDED_PAIR(pcg64, pcg64_random_t, pcg64_random_r)
+PRNG_DEFINE_SHUFFLE(pcg64, pcg64_random_t, 32)
+PRNG_DEFINE_SHUFFLE(pcg64, pcg64_random_t, 64)
+#endif
+
+#endif // PRNG_SHUFFLE_H
@@ -0,0 +1,483 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Multi-lane versions of prng.h generators for bulk fills.
+
+   A multi-lane context runs several independent generators in lockstep,
+   one per SIMD lane, and the fill functions write their outputs
+   interleaved: out[row * lanes + lane]. The AVX2 and AVX-512 kernels are
+   picked at runtime from the CPU, and a scalar loop produces the very
+   same output on any other machine.
+
+   Fill lengths should be a multiple of the lane count. Any remainder is
+   taken from one extra row and the rest of that row is discarded.
+ */
+
+#ifndef PRNG_SIMD_H
+#define PRNG_SIMD_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "prng.h"
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+#define PRNG_SIMD_X86 1
+#include <immintrin.h>
+#define PRNG_HAS_AVX2()   __builtin_cpu_supports("avx2")
+#define PRNG_HAS_AVX512() __builtin_cpu_supports("avx512f")
+#define PRNG_HAS_AVX512DQ() (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512dq"))
+#define PRNG_HAS_AVX512VL() (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512vl"))
+#else
+#define PRNG_SIMD_X86 0
+#define PRNG_HAS_AVX2()   0
+#define PRNG_HAS_AVX512() 0
+#define PRNG_HAS_AVX512DQ() 0
+#define PRNG_HAS_AVX512VL() 0
+#endif
+
+
+// xoshiro256 with 4 and 8 lanes, each lane 2^128 steps ahead of the
+// previous one so their sequences never overlap
+typedef struct { uint64_t s[4][4]; } xoshiro256x4_t;
+typedef struct { uint64_t s[4][8]; } xoshiro256x8_t;
+
+static inline void xoshiro256xn_seed(uint64_t *s, size_t lanes, xoshiro256_t const *seed) {
+	xoshiro256_t x = *seed;
+	for (size_t l = 0; l < lanes; ++l) {
+		for (int w = 0; w < 4; ++w) { s[w * lanes + l] = x.s[w]; }
+		xoshiro256_jump(&x);
+	}
+}
+static inline void xoshiro256x4_seed(xoshiro256x4_t *rng, xoshiro256_t const *seed) {
+	xoshiro256xn_seed(&rng->s[0][0], 4, seed);
+}
+static inline void xoshiro256x8_seed(xoshiro256x8_t *rng, xoshiro256_t const *seed) {
+	xoshiro256xn_seed(&rng->s[0][0], 8, seed);
+}
+
+// Scalar fallback, one lane at a time with its state in registers
+#define XOSHIRO256XN_SCALAR(variant) \
+static inline void xoshiro256##variant##xn_scalar(uint64_t *s, size_t lanes, uint64_t *out, size_t rows) { \
+	for (size_t l = 0; l < lanes; ++l) { \
+		xoshiro256_t x = {{ s[l], s[lanes + l], s[2 * lanes + l], s[3 * lanes + l] }}; \
+		for (size_t r = 0; r < rows; ++r) { out[r * lanes + l] = xoshiro256##variant##_next(&x); } \
+		for (int w = 0; w < 4; ++w) { s[w * lanes + l] = x.s[w]; } \
+	} \
+}
+XOSHIRO256XN_SCALAR(pp)
+XOSHIRO256XN_SCALAR(ss)
+
+#if PRNG_SIMD_X86
+// AVX2 has no 64-bit rotate or multiply, so both are built from
+// shifts; x * 5 and x * 9 are (x << 2) + x and (x << 3) + x
+#define rot64_avx2(x,k) _mm256_or_si256(_mm256_slli_epi64((x), (k)), _mm256_srli_epi64((x), 64 - (k)))
+
+#define XOSHIRO256_STEP_AVX2(s0, s1, s2, s3) do { \
+	__m256i const t = _mm256_slli_epi64(s1, 17); \
+	s2 = _mm256_xor_si256(s2, s0); \
+	s3 = _mm256_xor_si256(s3, s1); \
+	s1 = _mm256_xor_si256(s1, s2); \
+	s0 = _mm256_xor_si256(s0, s3); \
+	s2 = _mm256_xor_si256(s2, t); \
+	s3 = rot64_avx2(s3, 45); \
+} while (0)
+
+static inline __attribute__((target("avx2"))) __m256i xoshiro256pp_avx2(__m256i s0, __m256i s3) {
+	__m256i const sum = _mm256_add_epi64(s0, s3);
+	return _mm256_add_epi64(rot64_avx2(sum, 23), s0);
+}
+static inline __attribute__((target("avx2"))) __m256i xoshiro256ss_avx2(__m256i s1) {
+	__m256i const x5 = _mm256_add_epi64(_mm256_slli_epi64(s1, 2), s1);
+	__m256i const r = rot64_avx2(x5, 7);
+	return _mm256_add_epi64(_mm256_slli_epi64(r, 3), r);
+}
+
+// Lanes are processed four at a time, two vectors per row for the
+// 8-lane engine so the two dependency chains overlap
+#define XOSHIRO256XN_AVX2(variant, result) \
+static __attribute__((target("avx2"))) void xoshiro256##variant##xn_avx2(uint64_t *s, size_t lanes, uint64_t *out, size_t rows) { \
+	for (size_t l = 0; l < lanes; l += 8) { \
+		__m256i s0 = _mm256_loadu_si256((__m256i*)(s + l)); \
+		__m256i s1 = _mm256_loadu_si256((__m256i*)(s + lanes + l)); \
+		__m256i s2 = _mm256_loadu_si256((__m256i*)(s + 2 * lanes + l)); \
+		__m256i s3 = _mm256_loadu_si256((__m256i*)(s + 3 * lanes + l)); \
+		if (lanes - l < 8) { \
+			for (size_t r = 0; r < rows; ++r) { \
+				_mm256_storeu_si256((__m256i*)(out + r * lanes + l), result(s0, s1, s3)); \
+				XOSHIRO256_STEP_AVX2(s0, s1, s2, s3); \
+			} \
+		} else { \
+			__m256i u0 = _mm256_loadu_si256((__m256i*)(s + l + 4)); \
+			__m256i u1 = _mm256_loadu_si256((__m256i*)(s + lanes + l + 4)); \
+			__m256i u2 = _mm256_loadu_si256((__m256i*)(s + 2 * lanes + l + 4)); \
+			__m256i u3 = _mm256_loadu_si256((__m256i*)(s + 3 * lanes + l + 4)); \
+			for (size_t r = 0; r < rows; ++r) { \
+				_mm256_storeu_si256((__m256i*)(out + r * lanes + l), result(s0, s1, s3)); \
+				_mm256_storeu_si256((__m256i*)(out + r * lanes + l + 4), result(u0, u1, u3)); \
+				XOSHIRO256_STEP_AVX2(s0, s1, s2, s3); \
+				XOSHIRO256_STEP_AVX2(u0, u1, u2, u3); \
+			} \
+			_mm256_storeu_si256((__m256i*)(s + l + 4), u0); \
+			_mm256_storeu_si256((__m256i*)(s + lanes + l + 4), u1); \
+			_mm256_storeu_si256((__m256i*)(s + 2 * lanes + l + 4), u2); \
+			_mm256_storeu_si256((__m256i*)(s + 3 * lanes + l + 4), u3); \
+		} \
+		_mm256_storeu_si256((__m256i*)(s + l), s0); \
+		_mm256_storeu_si256((__m256i*)(s + lanes + l), s1); \
+		_mm256_storeu_si256((__m256i*)(s + 2 * lanes + l), s2); \
+		_mm256_storeu_si256((__m256i*)(s + 3 * lanes + l), s3); \
+	} \
+}
+#define XOSHIRO256PP_AVX2(s0, s1, s3) xoshiro256pp_avx2(s0, s3)
+#define XOSHIRO256SS_AVX2(s0, s1, s3) xoshiro256ss_avx2(s1)
+XOSHIRO256XN_AVX2(pp, XOSHIRO256PP_AVX2)
+XOSHIRO256XN_AVX2(ss, XOSHIRO256SS_AVX2)
+
+// AVX-512 has a native 64-bit rotate, all 8 lanes in one vector
+static inline __attribute__((target("avx512f"))) __m512i xoshiro256pp_avx512(__m512i s0, __m512i s3) {
+	return _mm512_add_epi64(_mm512_rol_epi64(_mm512_add_epi64(s0, s3), 23), s0);
+}
+static inline __attribute__((target("avx512f"))) __m512i xoshiro256ss_avx512(__m512i s1) {
+	__m512i const x5 = _mm512_add_epi64(_mm512_slli_epi64(s1, 2), s1);
+	__m512i const r = _mm512_rol_epi64(x5, 7);
+	return _mm512_add_epi64(_mm512_slli_epi64(r, 3), r);
+}
+#define XOSHIRO256XN_AVX512(variant, result) \
+static __attribute__((target("avx512f"))) void xoshiro256##variant##xn_avx512(uint64_t *s, uint64_t *out, size_t rows) { \
+	__m512i s0 = _mm512_loadu_si512(s); \
+	__m512i s1 = _mm512_loadu_si512(s + 8); \
+	__m512i s2 = _mm512_loadu_si512(s + 16); \
+	__m512i s3 = _mm512_loadu_si512(s + 24); \
+	for (size_t r = 0; r < rows; ++r) { \
+		_mm512_storeu_si512(out + r * 8, result); \
+		__m512i const t = _mm512_slli_epi64(s1, 17); \
+		s2 = _mm512_xor_si512(s2, s0); \
+		s3 = _mm512_xor_si512(s3, s1); \
+		s1 = _mm512_xor_si512(s1, s2); \
+		s0 = _mm512_xor_si512(s0, s3); \
+		s2 = _mm512_xor_si512(s2, t); \
+		s3 = _mm512_rol_epi64(s3, 45); \
+	} \
+	_mm512_storeu_si512(s, s0); \
+	_mm512_storeu_si512(s + 8, s1); \
+	_mm512_storeu_si512(s + 16, s2); \
+	_mm512_storeu_si512(s + 24, s3); \
+}
+XOSHIRO256XN_AVX512(pp, xoshiro256pp_avx512(s0, s3))
+XOSHIRO256XN_AVX512(ss, xoshiro256ss_avx512(s1))
+#endif
+
+// Fill functions, dispatching whole rows to the widest kernel the CPU
+// supports and taking a partial last row from a scratch row
+#define XOSHIRO256XN_FILL(variant, lanes, avx512) \
+static inline void xoshiro256##variant##x##lanes##_fill(xoshiro256x##lanes##_t *rng, void *buf, size_t n) { \
+	uint64_t *s = &rng->s[0][0]; \
+	uint64_t *out = buf; \
+	size_t const rows = n / lanes; \
+	if (rows > 0) { \
+		if (avx512 && PRNG_HAS_AVX512()) { XOSHIRO256XN_CALL_AVX512(variant, s, out, rows); } \
+		else if (PRNG_HAS_AVX2()) { XOSHIRO256XN_CALL_AVX2(variant, s, lanes, out, rows); } \
+		else { xoshiro256##variant##xn_scalar(s, lanes, out, rows); } \
+	} \
+	if (n % lanes) { \
+		uint64_t tail[lanes]; \
+		xoshiro256##variant##x##lanes##_fill(rng, tail, lanes); \
+		memcpy(out + rows * lanes, tail, (n % lanes) * sizeof(uint64_t)); \
+	} \
+}
+#if PRNG_SIMD_X86
+#define XOSHIRO256XN_CALL_AVX512(variant, s, out, rows) xoshiro256##variant##xn_avx512(s, out, rows)
+#define XOSHIRO256XN_CALL_AVX2(variant, s, lanes, out, rows) xoshiro256##variant##xn_avx2(s, lanes, out, rows)
+#else
+#define XOSHIRO256XN_CALL_AVX512(variant, s, out, rows) (void)0
+#define XOSHIRO256XN_CALL_AVX2(variant, s, lanes, out, rows) (void)0
+#endif
+XOSHIRO256XN_FILL(pp, 4, 0)
+XOSHIRO256XN_FILL(ss, 4, 0)
+XOSHIRO256XN_FILL(pp, 8, 1)
+XOSHIRO256XN_FILL(ss, 8, 1)
+
+
+// pcg32 (pcg_setseq_64_xsh_rr_32) with 8 lanes, each lane its own
+// stream with a distinct increment. Every lane is bit-exact with
+// pcg32_next() here and pcg32_random_r() in pcg_variants.h on the
+// same state and increment.
+typedef struct { uint64_t state[8]; uint64_t inc[8]; } pcg32x8_t;
+
+// Seed like pcg32_srandom_r(), one initseq per lane selecting its stream
+static inline void pcg32x8_seed(pcg32x8_t *rng, uint64_t initstate, uint64_t const initseq[8]) {
+	for (int l = 0; l < 8; ++l) {
+		rng->inc[l] = (initseq[l] << 1u) | 1u;
+		rng->state[l] = rng->inc[l];
+		rng->state[l] += initstate;
+		rng->state[l] = rng->state[l] * 6364136223846793005ULL + rng->inc[l];
+	}
+}
+// Move lanes from and to scalar contexts, e.g. to continue a lane's
+// stream with pcg32_next() or pcg32_random_r()
+static inline void pcg32x8_load(pcg32x8_t *rng, pcg32_t const lanes[8]) {
+	for (int l = 0; l < 8; ++l) { rng->state[l] = lanes[l].state; rng->inc[l] = lanes[l].inc | 1; }
+}
+static inline void pcg32x8_store(pcg32x8_t const *rng, pcg32_t lanes[8]) {
+	for (int l = 0; l < 8; ++l) { lanes[l].state = rng->state[l]; lanes[l].inc = rng->inc[l]; }
+}
+
+static inline void pcg32x8_scalar(pcg32x8_t *rng, uint32_t *out, size_t rows) {
+	for (int l = 0; l < 8; ++l) {
+		pcg32_t x = { rng->state[l], rng->inc[l] };
+		for (size_t r = 0; r < rows; ++r) { out[r * 8 + l] = pcg32_next(&x); }
+		rng->state[l] = x.state;
+	}
+}
+
+#if PRNG_SIMD_X86
+// 64-bit multiply from three 32x32 bit multiplies, as AVX2 has no
+// 64-bit mullo: x * m = xlo * mlo + ((xhi * mlo + xlo * mhi) << 32)
+static inline __attribute__((target("avx2"))) __m256i pcg_mul64_avx2(__m256i x, __m256i mlo, __m256i mhi) {
+	__m256i const lo = _mm256_mul_epu32(x, mlo);
+	__m256i const cross = _mm256_add_epi64(_mm256_mul_epu32(_mm256_srli_epi64(x, 32), mlo), _mm256_mul_epu32(x, mhi));
+	return _mm256_add_epi64(lo, _mm256_slli_epi64(cross, 32));
+}
+// XSH RR output of 4 states, left in the low half of each 64-bit lane.
+// The rotate uses variable shifts; a shift by 32 when rot is 0 is
+// cleared by the final mask.
+static inline __attribute__((target("avx2"))) __m256i pcg_xsh_rr_avx2(__m256i x) {
+	__m256i const mask = _mm256_set1_epi64x(0xffffffff);
+	__m256i const v = _mm256_and_si256(_mm256_srli_epi64(_mm256_xor_si256(_mm256_srli_epi64(x, 18), x), 27), mask);
+	__m256i const rot = _mm256_srli_epi64(x, 59);
+	__m256i const r = _mm256_or_si256(_mm256_srlv_epi64(v, rot), _mm256_sllv_epi64(v, _mm256_sub_epi64(_mm256_set1_epi64x(32), rot)));
+	return _mm256_and_si256(r, mask);
+}
+// A single lane's LCG is one long multiply-add dependency chain, so
+// the kernels keep several consecutive rows in flight and advance each
+// of them K steps at a time with s * M^K + inc * (M^(K-1) + ... + 1)
+static inline void pcg32x8_leap(pcg32x8_t const *rng, int k, uint64_t *mult, uint64_t plus[8]) {
+	uint64_t m = 1, sum = 0;
+	for (int i = 0; i < k; ++i) { sum += m; m *= 6364136223846793005ULL; }
+	*mult = m;
+	for (int l = 0; l < 8; ++l) { plus[l] = rng->inc[l] * sum; }
+}
+
+static __attribute__((target("avx2"))) void pcg32x8_avx2(pcg32x8_t *rng, uint32_t *out, size_t rows) {
+	__m256i const pack = _mm256_setr_epi32(0, 2, 4, 6, 1, 3, 5, 7);
+	uint64_t m2, p2[8];
+	pcg32x8_leap(rng, 2, &m2, p2);
+	__m256i const mlo = _mm256_set1_epi64x(6364136223846793005ULL & 0xffffffff);
+	__m256i const mhi = _mm256_set1_epi64x(6364136223846793005ULL >> 32);
+	__m256i const m2lo = _mm256_set1_epi64x(m2 & 0xffffffff);
+	__m256i const m2hi = _mm256_set1_epi64x(m2 >> 32);
+	__m256i const i0 = _mm256_loadu_si256((__m256i*)rng->inc);
+	__m256i const i1 = _mm256_loadu_si256((__m256i*)(rng->inc + 4));
+	__m256i const p0 = _mm256_loadu_si256((__m256i*)p2);
+	__m256i const p1 = _mm256_loadu_si256((__m256i*)(p2 + 4));
+
+	// Rows r and r + 1 for lanes 0-3 (a) and 4-7 (b)
+	__m256i a0 = _mm256_loadu_si256((__m256i*)rng->state);
+	__m256i b0 = _mm256_loadu_si256((__m256i*)(rng->state + 4));
+	__m256i a1 = _mm256_add_epi64(pcg_mul64_avx2(a0, mlo, mhi), i0);
+	__m256i b1 = _mm256_add_epi64(pcg_mul64_avx2(b0, mlo, mhi), i1);
+
+	size_t r = 0;
+	for (; r + 2 <= rows; r += 2) {
+		// Outputs use the old state, for max ILP as in pcg32_random_r
+		__m256i const oa0 = _mm256_permutevar8x32_epi32(pcg_xsh_rr_avx2(a0), pack);
+		__m256i const ob0 = _mm256_permutevar8x32_epi32(pcg_xsh_rr_avx2(b0), pack);
+		__m256i const oa1 = _mm256_permutevar8x32_epi32(pcg_xsh_rr_avx2(a1), pack);
+		__m256i const ob1 = _mm256_permutevar8x32_epi32(pcg_xsh_rr_avx2(b1), pack);
+		_mm256_storeu_si256((__m256i*)(out + r * 8), _mm256_permute2x128_si256(oa0, ob0, 0x20));
+		_mm256_storeu_si256((__m256i*)(out + r * 8 + 8), _mm256_permute2x128_si256(oa1, ob1, 0x20));
+		a0 = _mm256_add_epi64(pcg_mul64_avx2(a0, m2lo, m2hi), p0);
+		b0 = _mm256_add_epi64(pcg_mul64_avx2(b0, m2lo, m2hi), p1);
+		a1 = _mm256_add_epi64(pcg_mul64_avx2(a1, m2lo, m2hi), p0);
+		b1 = _mm256_add_epi64(pcg_mul64_avx2(b1, m2lo, m2hi), p1);
+	}
+	if (r < rows) {
+		__m256i const oa0 = _mm256_permutevar8x32_epi32(pcg_xsh_rr_avx2(a0), pack);
+		__m256i const ob0 = _mm256_permutevar8x32_epi32(pcg_xsh_rr_avx2(b0), pack);
+		_mm256_storeu_si256((__m256i*)(out + r * 8), _mm256_permute2x128_si256(oa0, ob0, 0x20));
+		a0 = a1;
+		b0 = b1;
+	}
+	_mm256_storeu_si256((__m256i*)rng->state, a0);
+	_mm256_storeu_si256((__m256i*)(rng->state + 4), b0);
+}
+// AVX-512DQ has a native 64-bit multiply, all 8 lanes in one vector
+static inline __attribute__((target("avx512f"))) __m256i pcg_xsh_rr_avx512(__m512i x) {
+	__m512i const v = _mm512_and_si512(_mm512_srli_epi64(_mm512_xor_si512(_mm512_srli_epi64(x, 18), x), 27), _mm512_set1_epi64(0xffffffff));
+	__m512i const rot = _mm512_srli_epi64(x, 59);
+	__m512i const r = _mm512_or_si512(_mm512_srlv_epi64(v, rot), _mm512_sllv_epi64(v, _mm512_sub_epi64(_mm512_set1_epi64(32), rot)));
+	return _mm512_cvtepi64_epi32(r);
+}
+static __attribute__((target("avx512f,avx512dq"))) void pcg32x8_avx512(pcg32x8_t *rng, uint32_t *out, size_t rows) {
+	uint64_t m4, p4[8];
+	pcg32x8_leap(rng, 4, &m4, p4);
+	__m512i const mult = _mm512_set1_epi64(6364136223846793005ULL);
+	__m512i const mult4 = _mm512_set1_epi64(m4);
+	__m512i const inc = _mm512_loadu_si512(rng->inc);
+	__m512i const plus4 = _mm512_loadu_si512(p4);
+
+	// Rows r to r + 3
+	__m512i s[4];
+	s[0] = _mm512_loadu_si512(rng->state);
+	for (int k = 1; k < 4; ++k) { s[k] = _mm512_add_epi64(_mm512_mullo_epi64(s[k - 1], mult), inc); }
+
+	size_t r = 0;
+	for (; r + 4 <= rows; r += 4) {
+		for (int k = 0; k < 4; ++k) {
+			_mm256_storeu_si256((__m256i*)(out + (r + k) * 8), pcg_xsh_rr_avx512(s[k]));
+			s[k] = _mm512_add_epi64(_mm512_mullo_epi64(s[k], mult4), plus4);
+		}
+	}
+	size_t const tail = rows - r;
+	for (size_t k = 0; k < tail; ++k) { _mm256_storeu_si256((__m256i*)(out + (r + k) * 8), pcg_xsh_rr_avx512(s[k])); }
+	_mm512_storeu_si512(rng->state, s[tail]);
+}
+#endif
+
+static inline void pcg32x8_fill(pcg32x8_t *rng, void *buf, size_t n) {
+	uint32_t *out = buf;
+	size_t const rows = n / 8;
+	if (rows > 0) {
+#if PRNG_SIMD_X86
+		if (PRNG_HAS_AVX512DQ()) { pcg32x8_avx512(rng, out, rows); }
+		else if (PRNG_HAS_AVX2()) { pcg32x8_avx2(rng, out, rows); }
+		else
+#endif
+		{ pcg32x8_scalar(rng, out, rows); }
+	}
+	if (n % 8) {
+		uint32_t tail[8];
+		pcg32x8_fill(rng, tail, 8);
+		memcpy(out + rows * 8, tail, (n % 8) * sizeof(uint32_t));
+	}
+}
+
+
+// Bob Jenkins small fast PRNG with 8 x 32-bit and 4 x 64-bit lanes,
+// each lane an independent jsf32_t or jsf64_t context (the same layout
+// as ranctx32_t and ranctx64_t in jsf.c) stepped in lockstep
+typedef struct { uint32_t a[8]; uint32_t b[8]; uint32_t c[8]; uint32_t d[8]; } jsf32x8_t;
+typedef struct { uint64_t a[4]; uint64_t b[4]; uint64_t c[4]; uint64_t d[4]; } jsf64x4_t;
+
+#define JSFXN_LOAD(bits, lanes) \
+static inline void jsf##bits##x##lanes##_load(jsf##bits##x##lanes##_t *rng, jsf##bits##_t const ctx[lanes]) { \
+	for (int l = 0; l < lanes; ++l) { rng->a[l] = ctx[l].a; rng->b[l] = ctx[l].b; rng->c[l] = ctx[l].c; rng->d[l] = ctx[l].d; } \
+} \
+static inline void jsf##bits##x##lanes##_store(jsf##bits##x##lanes##_t const *rng, jsf##bits##_t ctx[lanes]) { \
+	for (int l = 0; l < lanes; ++l) { ctx[l].a = rng->a[l]; ctx[l].b = rng->b[l]; ctx[l].c = rng->c[l]; ctx[l].d = rng->d[l]; } \
+} \
+static inline void jsf##bits##x##lanes##_scalar(jsf##bits##x##lanes##_t *rng, uint##bits##_t *out, size_t rows) { \
+	for (int l = 0; l < lanes; ++l) { \
+		jsf##bits##_t x = { rng->a[l], rng->b[l], rng->c[l], rng->d[l] }; \
+		for (size_t r = 0; r < rows; ++r) { out[r * lanes + l] = jsf##bits##_next(&x); } \
+		rng->a[l] = x.a; rng->b[l] = x.b; rng->c[l] = x.c; rng->d[l] = x.d; \
+	} \
+}
+JSFXN_LOAD(32, 8)
+JSFXN_LOAD(64, 4)
+
+#if PRNG_SIMD_X86
+// Both kernels are written once and built for AVX2, with rotates from
+// shifts, and for AVX-512VL, which has native 256-bit rotates
+#define rot32_avx2(x,k) _mm256_or_si256(_mm256_slli_epi32((x), (k)), _mm256_srli_epi32((x), 32 - (k)))
+
+#define JSF32X8_KERNEL(isa, features, rot) \
+static __attribute__((target(features))) void jsf32x8_##isa(jsf32x8_t *rng, uint32_t *out, size_t rows) { \
+	__m256i a = _mm256_loadu_si256((__m256i*)rng->a); \
+	__m256i b = _mm256_loadu_si256((__m256i*)rng->b); \
+	__m256i c = _mm256_loadu_si256((__m256i*)rng->c); \
+	__m256i d = _mm256_loadu_si256((__m256i*)rng->d); \
+	for (size_t r = 0; r < rows; ++r) { \
+		__m256i const e = _mm256_sub_epi32(a, rot(b, 27)); \
+		a = _mm256_xor_si256(b, rot(c, 17)); \
+		b = _mm256_add_epi32(c, d); \
+		c = _mm256_add_epi32(d, e); \
+		d = _mm256_add_epi32(e, a); \
+		_mm256_storeu_si256((__m256i*)(out + r * 8), d); \
+	} \
+	_mm256_storeu_si256((__m256i*)rng->a, a); \
+	_mm256_storeu_si256((__m256i*)rng->b, b); \
+	_mm256_storeu_si256((__m256i*)rng->c, c); \
+	_mm256_storeu_si256((__m256i*)rng->d, d); \
+}
+JSF32X8_KERNEL(avx2, "avx2", rot32_avx2)
+JSF32X8_KERNEL(avx512, "avx512f,avx512vl", _mm256_rol_epi32)
+
+#define JSF64X4_KERNEL(isa, features, rot) \
+static __attribute__((target(features))) void jsf64x4_##isa(jsf64x4_t *rng, uint64_t *out, size_t rows) { \
+	__m256i a = _mm256_loadu_si256((__m256i*)rng->a); \
+	__m256i b = _mm256_loadu_si256((__m256i*)rng->b); \
+	__m256i c = _mm256_loadu_si256((__m256i*)rng->c); \
+	__m256i d = _mm256_loadu_si256((__m256i*)rng->d); \
+	for (size_t r = 0; r < rows; ++r) { \
+		__m256i const e = _mm256_sub_epi64(a, rot(b, 7)); \
+		a = _mm256_xor_si256(b, rot(c, 13)); \
+		b = _mm256_add_epi64(c, rot(d, 37)); \
+		c = _mm256_add_epi64(d, e); \
+		d = _mm256_add_epi64(e, a); \
+		_mm256_storeu_si256((__m256i*)(out + r * 4), d); \
+	} \
+	_mm256_storeu_si256((__m256i*)rng->a, a); \
+	_mm256_storeu_si256((__m256i*)rng->b, b); \
+	_mm256_storeu_si256((__m256i*)rng->c, c); \
+	_mm256_storeu_si256((__m256i*)rng->d, d); \
+}
+JSF64X4_KERNEL(avx2, "avx2", rot64_avx2)
+JSF64X4_KERNEL(avx512, "avx512f,avx512vl", _mm256_rol_epi64)
+#endif
+
+// Interleaved fill, out[row * lanes + lane], and lane-major fill where
+// lane l writes its next rows values to out[l * rows ...] in exactly
+// the order jsf32_next() or jsf64_next() would return them. The
+// lane-major fill is kept out of line: inlined at -O2, GCC 12 gave its
+// block the same stack slot as a caller's array declared in a loop.
+#define JSFXN_FILL(bits, lanes) \
+static inline void jsf##bits##x##lanes##_fill(jsf##bits##x##lanes##_t *rng, void *buf, size_t n) { \
+	uint##bits##_t *out = buf; \
+	size_t const rows = n / lanes; \
+	if (rows > 0) { \
+		if (PRNG_HAS_AVX512VL()) { JSFXN_CALL(bits, lanes, avx512, rng, out, rows); } \
+		else if (PRNG_HAS_AVX2()) { JSFXN_CALL(bits, lanes, avx2, rng, out, rows); } \
+		else { jsf##bits##x##lanes##_scalar(rng, out, rows); } \
+	} \
+	if (n % lanes) { \
+		uint##bits##_t tail[lanes]; \
+		jsf##bits##x##lanes##_fill(rng, tail, lanes); \
+		memcpy(out + rows * lanes, tail, (n % lanes) * sizeof(tail[0])); \
+	} \
+} \
+static __attribute__((noinline, unused)) void jsf##bits##x##lanes##_fill_lanes(jsf##bits##x##lanes##_t *rng, void *buf, size_t rows) { \
+	uint##bits##_t block[64 * lanes]; \
+	uint##bits##_t *out = buf; \
+	for (size_t r = 0; r < rows; r += 64) { \
+		size_t const m = rows - r < 64 ? rows - r : 64; \
+		jsf##bits##x##lanes##_fill(rng, block, m * lanes); \
+		for (int l = 0; l < lanes; ++l) { \
+			for (size_t i = 0; i < m; ++i) { out[l * rows + r + i] = block[i * lanes + l]; } \
+		} \
+	} \
+}
+#if PRNG_SIMD_X86
+#define JSFXN_CALL(bits, lanes, isa, rng, out, rows) jsf##bits##x##lanes##_##isa(rng, out, rows)
+#else
+#define JSFXN_CALL(bits, lanes, isa, rng, out, rows) (void)0
+#endif
+JSFXN_FILL(32, 8)
+JSFXN_FILL(64, 4)
+
+#endif // PRNG_SIMD_H
@@ -0,0 +1,419 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Normal and exponential variates by the Ziggurat method of Marsaglia
+   and Tsang, with 256 layers and 64-bit words.
+
+   The low 8 bits of a word pick a layer and its high 52 bits place a
+   point along it. Points that fall inside the next layer up are
+   returned straight away, which is about 99% of the time for either
+   distribution, for the price of a multiply and a compare. The rest are
+   settled with one more word against the density, or drawn from the
+   tail beyond the base layer.
+
+   <name>_normal(), <name>_exponential() and their bulk fills are defined
+   for every generator in PRNG_LIST, with narrower outputs concatenated
+   into 64-bit words by <name>_next64(), and for pcg32_random and pcg64
+   from pcg_variants.h when it was included first.
+ */
+
+#ifndef PRNG_ZIGGURAT_H
+#define PRNG_ZIGGURAT_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "prng.h"
+
+// Layer edges and densities, unnormalised. X[1] is the start of the
+// tail R, and X[0] is the width of a rectangle with the area V of each
+// layer, the base layer and tail together. Layer i spans [0, X[i]) with
+// X[i+1] given by f(X[i+1]) = V / X[i] + f(X[i]), and X[256] = 0.
+// Generated in double precision from
+//   normal:      f(x) = exp(-x*x/2), R = 3.654152885361008796
+//   exponential: f(x) = exp(-x),     R = 7.69711747013104972
+// with V = R f(R) + the tail area, and F[i] = f(X[i]).
+static double const PRNG_ZIG_NORMAL_X[257] = {
+	3.9107579595249167, 3.654152885361009, 3.449278298561431, 3.320244733839825,
+	3.224575052047801, 3.147889289518, 3.0835261320021425, 3.027837791769593,
+	2.9786032798818427, 2.934366867208887, 2.894121053613412, 2.857138730873224,
+	2.8228773968264425, 2.790921174001927, 2.7609440052799856, 2.732685359044011,
+	2.7059336561230616, 2.6805146432857443, 2.6562830375767423, 2.633116393631582,
+	2.6109105184888226, 2.5895759867082857, 2.5690354526818426, 2.549221550324782,
+	2.5300752321598527, 2.5115444416266928, 2.4935830412710454, 2.4761499396705218,
+	2.4592083743347035, 2.4427253182003628, 2.4266709849371453, 2.411018413901118,
+	2.395743119781926, 2.3808227951720844, 2.36623705671729, 2.351967227379144,
+	2.337996148796528, 2.324308018871132, 2.3108882506013715, 2.297723348902863,
+	2.2848008027244915, 2.2721089902283813, 2.259637095173787, 2.2473750329473887,
+	2.2353133849299205, 2.2234433400925098, 2.21175664288416, 2.2002455466112756,
+	2.18890277162636, 2.177721467740292, 2.1666951803543073, 2.155817819876736,
+	2.1450836340478876, 2.1344871828460157, 2.1240233156895223, 2.1136871506866517,
+	2.1034740557148757, 2.09337963113879, 2.083399693998303, 2.0735302635187414,
+	2.0637675478117306, 2.0541079316506505, 2.04454796521753, 2.0350843537296175,
+	2.025713947863853, 2.0164337349062027, 2.0072408305605274, 1.9981324713584183,
+	1.9891060076174367, 1.9801588969004753, 1.971288697933658, 1.9624930649443617,
+	1.9537697423846454, 1.9451165600086768, 1.9365314282756931, 1.928012334052664,
+	1.9195573365931864, 1.9111645637712515, 1.9028322085504275, 1.894558525670703,
+	1.886341828536781, 1.878180486292994, 1.870072921071265, 1.8620176053996724,
+	1.8540130597602003, 1.8460578502851839, 1.838150586582805, 1.8302899196827553,
+	1.8224745400938844, 1.8147031759662813, 1.8069745913508195, 1.7992875845497187,
+	1.791640986552161, 1.78403365954944, 1.7764644955245215, 1.7689324149112673,
+	1.7614363653189091, 1.7539753203176704, 1.7465482782817214, 1.7391542612859108,
+	1.7317923140529623, 1.7244615029480441, 1.7171609150178224, 1.7098896570713011,
+	1.7026468547999223, 1.6954316519345607, 1.6882432094371944, 1.681080704725173,
+	1.6739433309261242, 1.6668302961616648, 1.6597408228581818, 1.6526741470830553,
+	1.6456295179047817, 1.638606196775547, 1.6316034569348727, 1.624620582833034,
+	1.617656869573015, 1.6107116223698297, 1.6037841560260941, 1.5968737944227878,
+	1.5899798700241905, 1.583101723396029, 1.576238702735906, 1.5693901634151233,
+	1.5625554675310445, 1.5557339834691761, 1.5489250854741732, 1.5421281532290017,
+	1.5353425714415139, 1.528567729437712, 1.5218030207609978, 1.5150478427767144,
+	1.5083015962813113, 1.5015636851154637, 1.4948335157804935, 1.4881104970574472,
+	1.481394039628187, 1.4746835556978553, 1.4679784586180793, 1.4612781625102753,
+	1.45458208188841, 1.4478896312805758, 1.4412002248487237, 1.4345132760058918,
+	1.4278281970302555, 1.4211443986753085, 1.4144612897754707, 1.4077782768463982,
+	1.4010947636792503, 1.3944101509281404, 1.3877238356899755, 1.3810352110758548,
+	1.3743436657731656, 1.3676485835974754, 1.3609493430332822, 1.354245316762634,
+	1.3475358711805863, 1.340820365896403, 1.334098153219359, 1.3273685776279247,
+	1.3206309752210552, 1.3138846731502194, 1.30712898903073, 1.3003632303308361,
+	1.2935866937369467, 1.2867986644932425, 1.279998415713817, 1.2731852076653554,
+	1.2663582870182284, 1.2595168860637131, 1.2526602218948961, 1.2457874955486261,
+	1.2388978911056863, 1.231990574746135, 1.2250646937565297, 1.2181193754854807,
+	1.2111537262436982, 1.2041668301443804, 1.1971577478794404, 1.190125515426691,
+	1.1830691426826856, 1.1759876120154509, 1.1688798767308322, 1.1617448594456106,
+	1.1545814503599268, 1.1473885054208481, 1.1401648443681505, 1.132909248652533,
+	1.1256204592155323, 1.1182971741193437, 1.1109380460135743, 1.1035416794246382,
+	1.09610662785202, 1.0886313906539782, 1.0811144097034022, 1.0735540657924345,
+	1.0659486747621207, 1.0582964833306734, 1.0505956645909282, 1.0428443131441474,
+	1.0350404398334394, 1.0271819660356445, 1.019266717465483, 1.0112924174399947,
+	1.003256679544672, 0.9951569996350901, 0.9869907470990615, 0.9787551552942237,
+	0.9704473110642236, 0.9620641432230397, 0.9536024098810852, 0.9450586844681645,
+	0.9364293402865742, 0.9277105334019992, 0.9188981836495896, 0.9099879534967176,
+	0.9009752244612208, 0.8918550707329405, 0.8826222295851646, 0.8732710680888597,
+	0.8637955455533078, 0.8541891710081628, 0.844444954909153, 0.834555354086381,
+	0.8245122087522911, 0.8143066701352142, 0.8039291169899702, 0.7933690588406223,
+	0.782615023307232, 0.7716544242245669, 0.7604734064301069, 0.7490566620178141,
+	0.7373872114342944, 0.7254461409099985, 0.7132122851909748, 0.7006618411068138,
+	0.6877678927957872, 0.6744998228372925, 0.6608225742444183, 0.6466957148949922,
+	0.6320722363860595, 0.6168969900077496, 0.6011046177559908, 0.5846167661063775,
+	0.5673382570538168, 0.549151702327163, 0.529909720661556, 0.5094233296020896,
+	0.4874439661392335, 0.4636343367908794, 0.4375184022078686, 0.40838913461198767,
+	0.3751213328783766, 0.33573751921442047, 0.2861745917920662, 0.21524189598487156,
+	0.0
+};
+static double const PRNG_ZIG_NORMAL_F[257] = {
+	0.0004774677646093862, 0.001260285930498598, 0.002609072746102164, 0.0040379725933630374,
+	0.005522403299251011, 0.0070508754713732415, 0.008616582769398749, 0.010214971439701487,
+	0.01184275785790791, 0.01349745060173989, 0.015177088307935337, 0.016880083152543187,
+	0.01860512127572467, 0.020351096230044538, 0.0221170627073089, 0.02390220330579591,
+	0.025705804008548945, 0.027527235669603148, 0.029365939758133387, 0.031221417191920328,
+	0.03309321945857862, 0.034980941461716174, 0.0368842156885674, 0.03880270740452624,
+	0.040736110655941085, 0.04268414491647461, 0.0446465522512946, 0.04662309490193053,
+	0.048613553215868695, 0.05061772386094794, 0.05263541827679238, 0.054666461324889094,
+	0.05671069010620308, 0.058767952920933925, 0.06083810834954002, 0.06292102443775822,
+	0.06501657797124295, 0.06712465382778857, 0.06924514439700682, 0.07137794905889047,
+	0.07352297371398138, 0.07568013035892718, 0.07784933670209612, 0.08003051581466315,
+	0.08222359581320299, 0.08442850957035354, 0.08664519445055814, 0.08887359206827597,
+	0.09111364806637383, 0.0933653119126911, 0.09562853671300908, 0.09790327903886259,
+	0.1001894987688101, 0.10248715894193534, 0.10479622562248721, 0.107116667774684,
+	0.10944845714681205, 0.11179156816383844, 0.11414597782783878, 0.11651166562561123,
+	0.11888861344291038, 0.12127680548479063, 0.1236762282015969, 0.12608687022018628,
+	0.1285087222799999, 0.13094177717364472, 0.13338602969166952, 0.13584147657125412,
+	0.1383081164485511, 0.14078594981444506, 0.14327497897351382, 0.14577520800599442,
+	0.14828664273257494, 0.15080929068184615, 0.1533431610602633, 0.15588826472447975,
+	0.15844461415592484, 0.16101222343751165, 0.16359110823236628, 0.16618128576448263,
+	0.1687827748012121, 0.1713955956375065, 0.17401977008183936, 0.17665532144373555,
+	0.17930227452284822, 0.18196065559952312, 0.18463049242679985, 0.1873118142238008,
+	0.19000465167046546, 0.19270903690358965, 0.1954250035141348, 0.19815258654577567,
+	0.20089182249465717, 0.20364274931033544, 0.20640540639788124, 0.2091798346211255,
+	0.2119660763070306, 0.214764175251174, 0.21757417672433152, 0.22039612748015233,
+	0.22323007576391782, 0.22607607132238053, 0.22893416541468053, 0.2318044108243389,
+	0.23468686187233026, 0.23758157443123834, 0.24048860594050084, 0.24340801542275048,
+	0.246339863501264, 0.24928421241852858, 0.25224112605594223, 0.25521066995466196,
+	0.25819291133761924, 0.2611879191327212, 0.2641957639972612, 0.26721651834356147,
+	0.27025025636587546, 0.27329705406857707, 0.2763569892956683, 0.27943014176163794,
+	0.2825165930837076, 0.28561642681550176, 0.2887297284821829, 0.2918565856170952,
+	0.2949970877999618, 0.2981513266966855, 0.30131939610080305, 0.30450139197665,
+	0.30769741250429206, 0.3109075581262865, 0.3141319315963372, 0.3173706380299136,
+	0.32062378495690536, 0.3238914823763911, 0.3271738428136014, 0.3304709813791636,
+	0.33378301583071845, 0.33711006663700605, 0.34045225704452187, 0.3438097131468507,
+	0.34718256395679364, 0.3505709414814061, 0.3539749808000768, 0.3573948201457805,
+	0.36083060098964803, 0.36428246812900406, 0.3677505697790326, 0.37123505766823955,
+	0.37473608713789125, 0.3782538172456193, 0.38178841087339377, 0.38534003484007745,
+	0.38890886001878894, 0.39249506145931584, 0.39609881851583273, 0.39972031498019756,
+	0.40335973922111484, 0.40701728432947376, 0.41069314827018866, 0.4143875340408916,
+	0.4181006498378486, 0.42183270922949634, 0.4255839313380224, 0.4293545410294419,
+	0.43314476911265276, 0.436954852547986, 0.4407850346658044, 0.4446355653957398,
+	0.4485067015072034, 0.45239870686184896, 0.45631185267871677, 0.4602464178128432,
+	0.46420268904817463, 0.4681809614056939, 0.4721815384677304, 0.47620473271950614,
+	0.48025086590904703, 0.4843202694266836, 0.4884132847054583, 0.4925302636438688,
+	0.4966715690524901, 0.5008375751261491, 0.5050286679434685, 0.5092452459957482,
+	0.5134877207473272, 0.5177565172297565, 0.522052074672322, 0.5263748471716846,
+	0.5307253044036623, 0.535103932380458, 0.5395112342569526, 0.5439477311900267,
+	0.5484139632552664, 0.552910490425833, 0.5574378936187666, 0.5619967758145251,
+	0.566587763256165, 0.5712115067352538, 0.5758686829723543, 0.5805599961007915,
+	0.5852861792633718, 0.5900479963328262, 0.5948462437679877, 0.5996817526191256,
+	0.604555390697468, 0.6094680649257737, 0.6144207238889141, 0.6194143606058345,
+	0.6244500155470267, 0.6295287799248369, 0.6346517992876238, 0.6398202774530568,
+	0.6450354808208226, 0.650298743110817, 0.6556114705796976, 0.6609751477766634,
+	0.6663913439087504, 0.6718617198970824, 0.6773880362187737, 0.6829721616449951,
+	0.688616083004672, 0.6943219161261169, 0.7000919181365118, 0.7059285013327545,
+	0.7118342488782486, 0.7178119326307222, 0.7238645334686304, 0.7299952645614765,
+	0.736207598126863, 0.7425052963401514, 0.7488924472191572, 0.7553735065070964,
+	0.7619533468367955, 0.7686373157984865, 0.7754313049811874, 0.7823418326548027,
+	0.7893761435660249, 0.7965423304229593, 0.8038494831709647, 0.8113078743126567,
+	0.8189291916037029, 0.826726833946222, 0.8347162929868841, 0.8429156531122048,
+	0.8513462584586786, 0.8600336211963322, 0.8690086880368577, 0.8783096558089181,
+	0.8879846607558342, 0.8980959218983443, 0.9087264400521318, 0.919991505039348,
+	0.9320600759592316, 0.9451989534423009, 0.9598790918001081, 0.9771017012676734,
+	1.0
+};
+static double const PRNG_ZIG_EXP_X[257] = {
+	8.697117470131051, 7.69711747013105, 6.941033629377213, 6.47837849383257,
+	6.144164665772473, 5.8821443157954, 5.666410167454034, 5.4828906275260625,
+	5.323090505754398, 5.1814872813015, 5.054288489981304, 4.9387770859012505,
+	4.832939741025112, 4.735242996601741, 4.644491885420085, 4.559737061707351,
+	4.480211746528422, 4.405287693473573, 4.334443680317273, 4.267242480277366,
+	4.203313713735184, 4.1423408656640515, 4.084051310408298, 4.028208544647937,
+	3.974606066673789, 3.9230625001354897, 3.873417670399509, 3.8255294185223367,
+	3.779270992411668, 3.7345288940397974, 3.691201090237419, 3.6491955157608538,
+	3.6084288131289095, 3.568825265648337, 3.5303158891293434, 3.4928376547740596,
+	3.45633282113276, 3.42074835725112, 3.386035442460301, 3.3521490309001094,
+	3.319047470970748, 3.2866921715990687, 3.25504730857045, 3.224079565286264,
+	3.1937579032122403, 3.164053358025973, 3.1349388580844404, 3.1063890623398245,
+	3.0783802152540902, 3.050890016615455, 3.0238975044556766, 2.9973829495161306,
+	2.9713277599210897, 2.9457143948950457, 2.920526286512741, 2.895747768600142,
+	2.8713640120155364, 2.847360965635189, 2.8237253024500353, 2.800444370250738,
+	2.7775061464397566, 2.7548991965623446, 2.7326126361947, 2.7106360958679288,
+	2.6889596887418037, 2.6675739807732666, 2.646469963151809, 2.6256390267977885,
+	2.6050729387408356, 2.5847638202141408, 2.5647041263169053, 2.54488662711187,
+	2.525304390037828, 2.505950763528594, 2.4868193617402095, 2.467904050297365,
+	2.4491989329782498, 2.4306983392644197, 2.4123968126888706, 2.394289099921458,
+	2.3763701405361406, 2.3586350574093373, 2.3410791477030344, 2.3236978743901964,
+	2.30648685828358, 2.2894418705322694, 2.272558825553155, 2.255833774367219,
+	2.239262898312909, 2.222842503111037, 2.206569013257664, 2.19043896672322,
+	2.1744490099377747, 2.158595893043886, 2.142876465399842, 2.1272876713173683,
+	2.111826546019042, 2.096490211801715, 2.081275874393225, 2.0661808194905755,
+	2.051202409468585, 2.0363380802487696, 2.021585338318926, 2.0069417578945186,
+	1.9924049782135766, 1.9779727009573604, 1.9636426877895483, 1.949412758007185,
+	1.9352807862970514, 1.921244700591528, 1.9073024800183875, 1.8934521529393082,
+	1.8796917950722112, 1.866019527692828, 1.8524335159111756, 1.83893196701888,
+	1.8255131289035198, 1.8121752885263906, 1.7989167704602909, 1.785735935484126,
+	1.7726311792313056, 1.7596009308890748, 1.7466436519460744, 1.7337578349855716,
+	1.7209420025219353, 1.7081947058780578, 1.695514524101538, 1.682900062917554,
+	1.6703499537164521, 1.6578628525741728, 1.6454374393037237, 1.6330724165359913,
+	1.620766508828258, 1.6085184617988584, 1.5963270412864834, 1.584191032532689,
+	1.5721092393862297, 1.560080483527888, 1.5481036037145135, 1.536177455041032,
+	1.5243009082192263, 1.512472848872117, 1.5006921768428167, 1.488957805516746,
+	1.4772686611561339, 1.4656236822457454, 1.4540218188487934, 1.4424620319720125,
+	1.4309432929388797, 1.4194645827699832, 1.4080248915695357, 1.3966232179170421,
+	1.3852585682631222, 1.3739299563284908, 1.362636402505087, 1.3513769332583354,
+	1.340150580529505, 1.328956381137117, 1.3177933761763252, 1.3066606104151746,
+	1.2955571316866015, 1.284481990275013, 1.2734342382962416, 1.2624129290696158,
+	1.251417116480853, 1.240445854334407, 1.2294981956938498, 1.218573192208791,
+	1.2076698934267622, 1.196787346088404, 1.185924593404203, 1.1750806743109123,
+	1.1642546227056796, 1.1534454666557754, 1.1426522275816735, 1.1318739194110792,
+	1.121109547701331, 1.110358108727412, 1.0996185885325982, 1.088889961938548,
+	1.0781711915113732, 1.0674612264799688, 1.0567590016025523, 1.046063435977045,
+	1.0353734317905294, 1.0246878730026183, 1.0140056239570978, 1.003325527915698,
+	0.9926464055072772, 0.9819670530850639, 0.9712862409839048, 0.960602711668668,
+	0.9499151777640774, 0.9392223199552638, 0.928522784747212, 0.9178151820700458,
+	0.9070980827156918, 0.8963700155898915, 0.8856294647617531, 0.8748748662910267,
+	0.864104604811006, 0.8533170098423749, 0.84251035181037, 0.8316828377342746,
+	0.8208326065544134, 0.80995772405742, 0.7990561773554887, 0.7881258688694941,
+	0.7771646097591313, 0.7661701127354362, 0.7551399841819838, 0.7440717155005095,
+	0.732962673584367, 0.7218100903087578, 0.7106110509096565, 0.6993624811032334,
+	0.6880611327737494, 0.6767035680295241, 0.6652861413926794, 0.6538049798476665,
+	0.6422559604245379, 0.630634684933492, 0.6189364513948777, 0.6071562216203017,
+	0.5952885842915044, 0.5833277127487712, 0.5712673165325899, 0.5591005855115422,
+	0.5468201251633121, 0.534417881237167, 0.5218850515921366, 0.509211982443656,
+	0.4963880455186726, 0.4834014916534633, 0.47023927508217045, 0.4568868409314218,
+	0.4433278660735541, 0.4295439402254126, 0.41551416960035825, 0.4012146788962796,
+	0.3866179779411214, 0.3716921453299192, 0.3563997602583957, 0.3406964810648512,
+	0.32452911701691145, 0.30783295467493427, 0.2905279554912326, 0.27251318547846703,
+	0.25365836338591446, 0.23379048305967726, 0.21267151063096923, 0.18995868962243467,
+	0.16512762256419042, 0.13730498094001628, 0.10483850756582322, 0.0638521638150076,
+	0.0
+};
+static double const PRNG_ZIG_EXP_F[257] = {
+	0.00016706669230796367, 0.0004541343538414966, 0.0009672692823271743, 0.0015362997803015726,
+	0.002145967743718907, 0.0027887987935740757, 0.003460264777836904, 0.004157295120833797,
+	0.004877655983542396, 0.005619642207205489, 0.006381905937319183, 0.007163353183634991,
+	0.007963077438017043, 0.008780314985808977, 0.009614413642502212, 0.01046481018102998,
+	0.0113310135978346, 0.012212592426255378, 0.013109164931254991, 0.014020391403181943,
+	0.014945968011691148, 0.015885621839973156, 0.01683910682603994, 0.017806200410911355,
+	0.018786700744696024, 0.01978042433800974, 0.020787204072578114, 0.02180688750428358,
+	0.02283933540638524, 0.023884420511558174, 0.024942026419731787, 0.02601204664513422,
+	0.027094383780955803, 0.028188948763978646, 0.02929566022463741, 0.03041444391046662,
+	0.03154523217289362, 0.032687963508959555, 0.03384258215087436, 0.03500903769739743,
+	0.03618728478193144, 0.03737728277295938, 0.03857899550307487, 0.03979239102337414,
+	0.04101744138041484, 0.042254122413316254, 0.0435024135688882, 0.04476229773294329,
+	0.046033761076175184, 0.04731679291318156, 0.048611385573379504, 0.04991753428270638,
+	0.05123523705512628, 0.052564494593071685, 0.05390531019604608, 0.05525768967669703,
+	0.05662164128374287, 0.05799717563120066, 0.05938430563342028, 0.06078304644547966,
+	0.062193415408541036, 0.06361543199980738, 0.0650491177867538, 0.06649449638533982,
+	0.06795159342193664, 0.06942043649872878, 0.07090105516237184, 0.07239348087570875,
+	0.07389774699236475, 0.07541388873405841, 0.07694194317048052, 0.07848194920160644,
+	0.0800339475423199, 0.08159798070923742, 0.0831740930096324, 0.08476233053236815,
+	0.08636274114075693, 0.08797537446727023, 0.08960028191003289, 0.0912375166310402,
+	0.09288713355604357, 0.09454918937605587, 0.09622374255043283, 0.09791085331149221,
+	0.09961058367063713, 0.10132299742595363, 0.1030481601712577, 0.10478613930657016,
+	0.10653700405000163, 0.10830082545103376, 0.11007767640518536, 0.11186763167005628,
+	0.11367076788274429, 0.1154871635786335, 0.11731689921155553, 0.11916005717532764,
+	0.12101672182667479, 0.12288697950954511, 0.12477091858083093, 0.12666862943751067,
+	0.1285802045452282, 0.13050573846833077, 0.1324453279013875, 0.1343990717022136,
+	0.13636707092642883, 0.13834942886358018, 0.1403462510748624, 0.14235764543247215,
+	0.14438372216063472, 0.1464245938783449, 0.14848037564386674, 0.15055118500103984,
+	0.1526371420274428, 0.15473836938446803, 0.15685499236936515, 0.15898713896931413,
+	0.16113493991759195, 0.16329852875190173, 0.16547804187493592, 0.16767361861725008,
+	0.16988540130252755, 0.17211353531531998, 0.1743581691713534, 0.17661945459049483,
+	0.17889754657247828, 0.18119260347549626, 0.18350478709776744, 0.18583426276219708,
+	0.18818119940425426, 0.19054576966319536, 0.1929281499767713, 0.1953285206795632,
+	0.19774706610509882, 0.2001839746919112, 0.20263943909370896, 0.20511365629383765,
+	0.20760682772422198, 0.21011915938898823, 0.21265086199297822, 0.21520215107537863,
+	0.21777324714870047, 0.22036437584335944, 0.2229757680581201, 0.22560766011668396,
+	0.22826029393071662, 0.23093391716962736, 0.2336287834374333, 0.23634515245705956,
+	0.2390832902624491, 0.24184346939887713, 0.24462596913189202, 0.24743107566532754,
+	0.2502590823688622, 0.25311029001562935, 0.25598500703041527, 0.25888354974901606,
+	0.2618062426893628, 0.26475341883506204, 0.26772541993204463, 0.27072259679905986,
+	0.2737453096528028, 0.2767939284485172, 0.27986883323697276, 0.28297041453878063,
+	0.2860990737370767, 0.2892552234896776, 0.2924392881618924, 0.295651704281261,
+	0.2988929210155815, 0.3021634006756933, 0.30546361924459003, 0.30879406693455996,
+	0.3121552487741794, 0.3155476852271287, 0.318971912844957, 0.322428484956089,
+	0.325917972393556, 0.32944096426413616, 0.33299806876180876, 0.3365899140286774,
+	0.34021714906677986, 0.34388044470450224, 0.3475804946216368, 0.35131801643748317,
+	0.3550937528667873, 0.35890847294874956, 0.3627629733548175, 0.3666580797815139,
+	0.3705946484351457, 0.3745735676159019, 0.3785957594095805, 0.3826621814960095,
+	0.3867738290841374, 0.3909317369847968, 0.3951369818332898, 0.39939068447523074,
+	0.40369401253052994, 0.40804818315203206, 0.41245446599716085, 0.41691418643300254,
+	0.42142872899761624, 0.425999541143034, 0.4306281372884585, 0.43531610321563624,
+	0.4400651008423535, 0.4448768734145481, 0.4497532511627546, 0.4546961574746151,
+	0.4597076156421373, 0.4647897562504258, 0.4699448252839596, 0.475175193037377,
+	0.4804833639304538, 0.4858719873418845, 0.49134386959403215, 0.49690198724154916,
+	0.5025495018413473, 0.5082897764106424, 0.5141263938147481, 0.5200631773682332,
+	0.5261042139836193, 0.5322538802630428, 0.5385168720028614, 0.5448982376724392,
+	0.5514034165406408, 0.558038282262587, 0.5648091929123997, 0.5717230486648253,
+	0.5787873586028445, 0.5860103184772675, 0.5934009016917329, 0.6009689663652317,
+	0.6087253820796215, 0.616682180915207, 0.6248527387036653, 0.6332519942143654,
+	0.6418967164272653, 0.6508058334145702, 0.6600008410789989, 0.669506316731924,
+	0.6793505722647646, 0.6895664961170771, 0.7001926550827873, 0.711274760805075,
+	0.722867659593571, 0.7350380924314225, 0.747868621985194, 0.7614633888498951,
+	0.7759568520401143, 0.7915276369724943, 0.8084216515230069, 0.8269932966430488,
+	0.8477855006239878, 0.8717043323812015, 0.9004699299257437, 0.9381436808621708,
+	1.0
+};
+
+// Words to doubles, [-1, 1) and [0, 1) on the high 52 bits, and (0, 1]
+// on the high 53 bits for logarithms
+static inline double prng_zig_signed(uint64_t x) {
+	uint64_t const bits = x >> 12 | 0x3ff0000000000000;
+	double d;
+	memcpy(&d, &bits, sizeof(d));
+	return 2.0 * d - 3.0;
+}
+static inline double prng_zig_unsigned(uint64_t x) {
+	uint64_t const bits = x >> 12 | 0x3ff0000000000000;
+	double d;
+	memcpy(&d, &bits, sizeof(d));
+	return d - 1.0;
+}
+static inline double prng_zig_open(uint64_t x) {
+	return (double)((x >> 11) + 1) * 0x1.0p-53;
+}
+
+// 64-bit words from any generator, high bits from the earlier outputs
+#define PRNG_DEFINE_NEXT64(name, type, ctx) \
+static inline uint64_t name##_next64(ctx *rng) { \
+	uint64_t x = (type)name##_next(rng); \
+	for (unsigned i = 8 * sizeof(type); i < 64; i += 8 * sizeof(type)) { \
+		x = x << (8 * sizeof(type) & 63) | (type)name##_next(rng); \
+	} \
+	return x; \
+}
+PRNG_LIST(PRNG_DEFINE_NEXT64)
+
+// The rare paths stay out of line so the fills keep a tight loop. A
+// layer that is not the base takes a uniform height between the two
+// densities; the base layer hands over to the tail, Marsaglia's method
+// for the normal and R plus a fresh variate for the memoryless
+// exponential.
+#define PRNG_DEFINE_ZIGGURAT(name, ctx, next) \
+static __attribute__((noinline)) int name##_normal_slow(ctx *rng, unsigned i, double *x) { \
+	if (i == 0) { \
+		double t, y; \
+		do { \
+			t = -log(prng_zig_open(next(rng))) / PRNG_ZIG_NORMAL_X[1]; \
+			y = -log(prng_zig_open(next(rng))); \
+		} while (y + y < t * t); \
+		*x = *x < 0 ? -PRNG_ZIG_NORMAL_X[1] - t : PRNG_ZIG_NORMAL_X[1] + t; \
+		return 1; \
+	} \
+	double const h = prng_zig_unsigned(next(rng)); \
+	return PRNG_ZIG_NORMAL_F[i + 1] + (PRNG_ZIG_NORMAL_F[i] - PRNG_ZIG_NORMAL_F[i + 1]) * h \
+		< exp(-0.5 * *x * *x); \
+} \
+static __attribute__((noinline)) int name##_exponential_slow(ctx *rng, unsigned i, double *x) { \
+	if (i == 0) { \
+		*x = PRNG_ZIG_EXP_X[1] - log(prng_zig_open(next(rng))); \
+		return 1; \
+	} \
+	double const h = prng_zig_unsigned(next(rng)); \
+	return PRNG_ZIG_EXP_F[i + 1] + (PRNG_ZIG_EXP_F[i] - PRNG_ZIG_EXP_F[i + 1]) * h < exp(-*x); \
+} \
+static inline double name##_normal(ctx *rng) { \
+	for (;;) { \
+		uint64_t const r = next(rng); \
+		unsigned const i = r & 0xff; \
+		double x = prng_zig_signed(r) * PRNG_ZIG_NORMAL_X[i]; \
+		if (fabs(x) < PRNG_ZIG_NORMAL_X[i + 1] || name##_normal_slow(rng, i, &x)) { return x; } \
+	} \
+} \
+static inline double name##_exponential(ctx *rng) { \
+	for (;;) { \
+		uint64_t const r = next(rng); \
+		unsigned const i = r & 0xff; \
+		double x = prng_zig_unsigned(r) * PRNG_ZIG_EXP_X[i]; \
+		if (x < PRNG_ZIG_EXP_X[i + 1] || name##_exponential_slow(rng, i, &x)) { return x; } \
+	} \
+} \
+static inline void name##_fill_normal(ctx *rng, double *out, size_t n) { \
+	ctx x = *rng; \
+	for (size_t i = 0; i < n; ++i) { out[i] = name##_normal(&x); } \
+	*rng = x; \
+} \
+static inline void name##_fill_exponential(ctx *rng, double *out, size_t n) { \
+	ctx x = *rng; \
+	for (size_t i = 0; i < n; ++i) { out[i] = name##_exponential(&x); } \
+	*rng = x; \
+}
+#define PRNG_DEFINE_ZIGGURAT_LIST(name, type, ctx) PRNG_DEFINE_ZIGGURAT(name, ctx, name##_next64)
+PRNG_LIST(PRNG_DEFINE_ZIGGURAT_LIST)
+
+#ifdef PCG_VARIANTS_H_INCLUDED
+// pcg32 is already the prng.h generator, so the pcg-c one keeps its
+// full name
+static inline uint64_t prng_pcg32_random_next64(pcg32_random_t *rng) {
+	uint64_t const hi = pcg32_random_r(rng);
+	return hi << 32 | pcg32_random_r(rng);
+}
+PRNG_DEFINE_ZIGGURAT(pcg32_random, pcg32_random_t, prng_pcg32_random_next64)
+#if PCG_HAS_128BIT_OPS
+PRNG_DEFINE_ZIGGURAT(pcg64, pcg64_random_t, pcg64_random_r)
+#endif
+#endif
+
+#endif // PRNG_ZIGGURAT_H
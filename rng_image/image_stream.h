@@ -0,0 +1,306 @@
+/* Copyright (C) 2021 @filterpaper
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 2 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/* Streaming image output for the RNG image programs.
+
+   image_write() generates an image a chunk of rows at a time and writes
+   each chunk out as soon as it is complete, so memory use stays at two
+   chunks of about IMAGE_CHUNK bytes whatever the image size. The chunks
+   are double-buffered: a writer thread saves one while the caller's row
+   function fills the other, overlapping generation with I/O.
+
+   Two formats are written, picked by image_format_of() from the file
+   name:
+   - 24-bit BMP, stored top-down (negative height) so rows go out in
+     the order they are generated. Its header only holds sizes below
+     4 GiB; past that the size fields are left 0, which readers treat
+     as unknown.
+   - 8-bit grayscale PGM (P5) for names ending in .pgm, a third of the
+     size and without the size limit, for images such as 65536x65536.
+
+   image_write_mapped() is the alternative without any copy: the file
+   is sized with ftruncate() and mapped, the header written in place,
+   and threads fill disjoint bands of rows straight into the mapping,
+   leaving write-back to the kernel. image_write_mapped_rows() does
+   the same in one band with a row function, and image_map() gives
+   programs that build the image themselves the same mapping.
+ */
+
+#ifndef IMAGE_STREAM_H
+#define IMAGE_STREAM_H
+
+#include <pthread.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+// Bytes per chunk buffer, rounded down to whole rows but at least one
+#ifndef IMAGE_CHUNK
+#define IMAGE_CHUNK (4 << 20)
+#endif
+
+typedef enum { IMAGE_BMP, IMAGE_PGM } image_format_t;
+
+// Fills one row of width pixels, as blue, green, red bytes for 3
+// channels or one gray byte for 1. pixels always has room for
+// 3 * width bytes, so a gray row can be drawn as BGR and packed down
+// in place.
+typedef void (*image_row_fn)(void *arg, uint8_t *pixels, uint32_t width, int channels);
+
+static inline image_format_t image_format_of(char const *filename) {
+	size_t const n = strlen(filename);
+	return n >= 4 && strcmp(filename + n - 4, ".pgm") == 0 ? IMAGE_PGM : IMAGE_BMP;
+}
+static inline int image_channels(image_format_t format) {
+	return format == IMAGE_PGM ? 1 : 3;
+}
+// Bytes per row in the file, BMP rows being padded to 4 bytes
+static inline size_t image_stride(image_format_t format, uint32_t width) {
+	return format == IMAGE_PGM ? (size_t)width : ((size_t)width * 24 + 31) / 32 * 4;
+}
+
+static inline void image_le(uint8_t *out, uint32_t v, int bytes) {
+	for (int i = 0; i < bytes; ++i) { out[i] = (uint8_t)(v >> 8 * i); }
+}
+
+// Writes the file header to out and returns its length, at most
+// IMAGE_HEADER_MAX bytes
+#define IMAGE_HEADER_MAX 54
+static inline size_t image_header(uint8_t *out, image_format_t format, uint32_t width, uint32_t height) {
+	if (format == IMAGE_PGM) {
+		return (size_t)snprintf((char*)out, IMAGE_HEADER_MAX, "P5\n%lu %lu\n255\n", (unsigned long)width, (unsigned long)height);
+	}
+	// https://stackoverflow.com/questions/50090500/create-simple-bitmap-in-c-without-external-libraries
+	// total image size in bytes, not including header
+	uint64_t const imagesize = (uint64_t)image_stride(format, width) * height;
+	uint64_t const filesize = 54 + imagesize;
+	int const fits = filesize <= UINT32_MAX;
+
+	// written byte by byte instead of BITMAPFILEHEADER and
+	// BITMAPINFOHEADER to avoid problems with structure packing
+	memset(out, 0, 54);
+	memcpy(out, "BM", 2);
+	image_le(out + 2, fits ? (uint32_t)filesize : 0, 4);
+	image_le(out + 10, 54, 4); // bitmap bits start after both headers
+	image_le(out + 14, 40, 4); // sizeof(BITMAPINFOHEADER)
+	image_le(out + 18, width, 4);
+	image_le(out + 22, -height, 4); // negative for top-down rows
+	image_le(out + 26, 1, 2); // planes
+	image_le(out + 28, 24, 2); // bit count
+	image_le(out + 34, fits ? (uint32_t)imagesize : 0, 4);
+	return 54;
+}
+
+// Chunk handoff between image_write() and its writer thread; a length
+// is the bytes of that buffer waiting to be written, 0 when it is free
+typedef struct {
+	pthread_mutex_t lock;
+	pthread_cond_t cond;
+	FILE *file;
+	uint8_t *buf[2];
+	size_t len[2];
+	int done;
+	int error;
+} image_stream_t;
+
+// Writes the buffers in turn until image_write() is done and the next
+// one stays empty
+static void *image_stream_writer(void *arg) {
+	image_stream_t *s = arg;
+	for (int b = 0;; b ^= 1) {
+		pthread_mutex_lock(&s->lock);
+		while (!s->len[b] && !s->done) { pthread_cond_wait(&s->cond, &s->lock); }
+		size_t const len = s->len[b];
+		pthread_mutex_unlock(&s->lock);
+		if (!len) { return NULL; }
+
+		int const error = fwrite(s->buf[b], 1, len, s->file) != len;
+		pthread_mutex_lock(&s->lock);
+		s->error |= error;
+		s->len[b] = 0;
+		pthread_cond_broadcast(&s->cond);
+		pthread_mutex_unlock(&s->lock);
+	}
+}
+
+// Generates a width by height image top row first with row() and
+// streams it to filename. Returns 0, or -1 with errno set on failure.
+// Without a writer thread the chunks are written in line.
+static inline int image_write(char const *filename, uint32_t width, uint32_t height, image_row_fn row, void *arg) {
+	image_format_t const format = image_format_of(filename);
+	int const channels = image_channels(format);
+	size_t const stride = image_stride(format, width);
+	size_t const used = (size_t)width * channels;
+	size_t rows = IMAGE_CHUNK / stride;
+	if (rows < 1) { rows = 1; }
+	if (rows > height) { rows = height ? height : 1; }
+
+	FILE *file = fopen(filename, "wb");
+	if (!file) { return -1; }
+
+	// Room for the last row of a chunk to be drawn at full width
+	size_t const size = rows * stride + 3 * (size_t)width;
+	image_stream_t s = { .file = file, .buf = { malloc(size), malloc(size) } };
+	uint8_t header[IMAGE_HEADER_MAX];
+	size_t const header_len = image_header(header, format, width, height);
+	int ok = s.buf[0] && s.buf[1] && fwrite(header, 1, header_len, file) == header_len;
+
+	pthread_mutex_init(&s.lock, NULL);
+	pthread_cond_init(&s.cond, NULL);
+	pthread_t writer;
+	int const threaded = ok && pthread_create(&writer, NULL, image_stream_writer, &s) == 0;
+
+	for (uint32_t y = 0, b = 0; ok && y < height; b ^= 1) {
+		uint32_t const n = height - y < rows ? height - y : (uint32_t)rows;
+		if (threaded) {
+			pthread_mutex_lock(&s.lock);
+			while (s.len[b]) { pthread_cond_wait(&s.cond, &s.lock); }
+			ok = !s.error;
+			pthread_mutex_unlock(&s.lock);
+			if (!ok) { break; }
+		}
+
+		uint8_t *pixels = s.buf[b];
+		for (uint32_t r = 0; r < n; ++r, pixels += stride) {
+			row(arg, pixels, width, channels);
+			memset(pixels + used, 0, stride - used);
+		}
+
+		size_t const len = n * stride;
+		if (threaded) {
+			pthread_mutex_lock(&s.lock);
+			s.len[b] = len;
+			pthread_cond_broadcast(&s.cond);
+			pthread_mutex_unlock(&s.lock);
+		} else if (ok && fwrite(s.buf[b], 1, len, file) != len) {
+			ok = 0;
+		}
+		y += n;
+	}
+
+	if (threaded) {
+		pthread_mutex_lock(&s.lock);
+		s.done = 1;
+		pthread_cond_broadcast(&s.cond);
+		pthread_mutex_unlock(&s.lock);
+		pthread_join(writer, NULL);
+		ok = ok && !s.error;
+	}
+	pthread_cond_destroy(&s.cond);
+	pthread_mutex_destroy(&s.lock);
+	free(s.buf[0]);
+	free(s.buf[1]);
+	ok = fclose(file) == 0 && ok;
+	return ok ? 0 : -1;
+}
+
+// Creates filename at size bytes, all zero, and maps it for writing.
+// Returns NULL with errno set on failure.
+static inline uint8_t *image_map(char const *filename, size_t size) {
+	int const fd = open(filename, O_RDWR | O_CREAT | O_TRUNC, 0644);
+	if (fd < 0) { return NULL; }
+	void *map = ftruncate(fd, (off_t)size) == 0 ? mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0) : MAP_FAILED;
+	close(fd);
+	return map == MAP_FAILED ? NULL : map;
+}
+static inline int image_unmap(uint8_t *map, size_t size) {
+	return munmap(map, size);
+}
+
+// Fills count rows of the image starting at row first, row first + i
+// going to pixels + i * stride as in image_row_fn. Only the row bytes
+// may be written; the padding is already zero.
+typedef void (*image_band_fn)(void *arg, uint8_t *pixels, size_t stride, uint32_t first, uint32_t count, uint32_t width, int channels);
+
+typedef struct {
+	image_band_fn band;
+	void *arg;
+	uint8_t *pixels;
+	size_t stride;
+	uint32_t first, count, width;
+	int channels;
+} image_band_t;
+
+static void *image_band_worker(void *arg) {
+	image_band_t const *b = arg;
+	b->band(b->arg, b->pixels, b->stride, b->first, b->count, b->width, b->channels);
+	return NULL;
+}
+
+// Generates a width by height image into a mapping of filename, split
+// into bands of rows filled by band() on as many threads, top band
+// first. With one band it runs on the calling thread, as does any band
+// whose thread can't be started. Returns 0, or -1 with errno set.
+static inline int image_write_mapped(char const *filename, uint32_t width, uint32_t height, int bands, image_band_fn band, void *arg) {
+	image_format_t const format = image_format_of(filename);
+	size_t const stride = image_stride(format, width);
+	uint8_t header[IMAGE_HEADER_MAX];
+	size_t const header_len = image_header(header, format, width, height);
+	size_t const size = header_len + stride * height;
+
+	uint8_t *map = image_map(filename, size);
+	if (!map) { return -1; }
+	memcpy(map, header, header_len);
+
+	if (bands < 1) { bands = 1; }
+	if ((uint32_t)bands > height) { bands = height ? (int)height : 1; }
+	uint32_t const rows = (height + bands - 1) / bands;
+	image_band_t job[bands];
+	pthread_t tid[bands];
+	int started[bands];
+	for (int k = 0; k < bands; ++k) {
+		uint32_t const first = (uint32_t)k * rows;
+		job[k] = (image_band_t){ band, arg, map + header_len + first * stride, stride,
+			first, first < height ? (height - first < rows ? height - first : rows) : 0, width, image_channels(format) };
+		started[k] = k && pthread_create(&tid[k], NULL, image_band_worker, &job[k]) == 0;
+	}
+	for (int k = 0; k < bands; ++k) {
+		if (!started[k]) { image_band_worker(&job[k]); }
+	}
+	for (int k = 0; k < bands; ++k) {
+		if (started[k]) { pthread_join(tid[k], NULL); }
+	}
+	return image_unmap(map, size);
+}
+
+// image_write_mapped() in a single band from a row function, for
+// generators that only have one sequence. Gray rows need 3 * width
+// bytes to be drawn, more than the two rows below them in the file, so
+// they are drawn in a spare row and copied into the mapping.
+typedef struct { image_row_fn row; void *arg; } image_rows_t;
+static void image_rows_band(void *arg, uint8_t *pixels, size_t stride, uint32_t first, uint32_t count, uint32_t width, int channels) {
+	image_rows_t const *r = arg;
+	uint8_t spare[channels == 1 ? 3 * (size_t)width : 1];
+	(void)first;
+	for (uint32_t i = 0; i < count; ++i, pixels += stride) {
+		if (channels == 1) {
+			r->row(r->arg, spare, width, channels);
+			memcpy(pixels, spare, width);
+		} else {
+			r->row(r->arg, pixels, width, channels);
+		}
+	}
+}
+static inline int image_write_mapped_rows(char const *filename, uint32_t width, uint32_t height, image_row_fn row, void *arg) {
+	image_rows_t r = { row, arg };
+	return image_write_mapped(filename, width, height, 1, image_rows_band, &r);
+}
+
+#endif // IMAGE_STREAM_H
@@ -26,8 +26,21 @@
    main() function, and link it to the macro RND.
 
    This file automaticaly generates bmp images for all rng function,
-   each RNG return value is type cast as 64-bit for consistency
-   as pointer variable to generate_image().
+   each RNG return value is type cast as 64-bit for consistency.
+   Each RNG gets a bulk fill wrapper that is passed as pointer variable
+   to generate_image(), so the RNG itself is called directly.
+
+   Images are rendered side by side by a pool of one thread per online
+   CPU, or THREADS if defined. Every generator keeps its state in
+   statics and is only called for its own image, so the output is the
+   same as rendering them one after another. WIDTH and HEIGHT can be
+   given on the command line, e.g. -DWIDTH=8000 -DHEIGHT=8000.
+
+   Images are streamed to file by image_write() from image_stream.h,
+   so memory use doesn't grow with their size; name them .pgm with
+   EXTENSION for 8-bit grayscale PGM instead of 24-bit BMP. With MMAP
+   they are drawn straight into a mapping of the file instead, in one
+   band as each generator has a single sequence.
  */
 
 
@@ -35,11 +48,21 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <pthread.h>
+#include <unistd.h>
+
+#include "image_stream.h"
 
 // Image output settings
 #define GRAYSCALE // Exclude for full RGB
+#ifndef WIDTH
 #define WIDTH  640
+#endif
+#ifndef HEIGHT
 #define HEIGHT 1200
+#endif
+#define EXTENSION ".bmp" // ".pgm" for 8-bit grayscale
+//#define MMAP // Write images through a memory mapping
 
 
 
@@ -360,100 +383,128 @@ static uint_fast64_t crand(void) {
 
 
 
-// Image loop that generates randomized pixel image into 32bit.bmp
-// https://stackoverflow.com/questions/50090500/create-simple-bitmap-in-c-without-external-libraries
-void generate_image(uint_fast64_t (*rngfunction)(), char filename[]) {
-	//width, height, and bitcount are the key factors:
-	static uint_fast32_t const width  = WIDTH;
-	static uint_fast32_t const height = HEIGHT;
-	static uint_fast16_t const bitcount = 24;//<- 24-bit bitmap
-
-	//take padding in to account
-	int width_in_bytes = ((width * bitcount + 31) / 32) * 4;
-
-	//total image size in bytes, not including header
-	uint_fast32_t imagesize = width_in_bytes * height;
-
-	//this value is always 40, it's the sizeof(BITMAPINFOHEADER)
-	static uint_fast32_t const biSize = 40;
-
-	//bitmap bits start after headerfile,
-	//this is sizeof(BITMAPFILEHEADER) + sizeof(BITMAPINFOHEADER)
-	static uint_fast32_t const bfOffBits = 54;
-
-	//total file size:
-	uint_fast32_t filesize = 54 + imagesize;
-
-	//number of planes is usually 1
-	static uint_fast16_t const biPlanes = 1;
-
-	//create header:
-	//copy to buffer instead of BITMAPFILEHEADER and BITMAPINFOHEADER
-	//to avoid problems with structure packing
-	unsigned char header[54] = { 0 };
-	memcpy(header, "BM", 2);
-	memcpy(header + 2 , &filesize, 4);
-	memcpy(header + 10, &bfOffBits, 4);
-	memcpy(header + 14, &biSize, 4);
-	memcpy(header + 18, &width, 4);
-	memcpy(header + 22, &height, 4);
-	memcpy(header + 26, &biPlanes, 2);
-	memcpy(header + 28, &bitcount, 2);
-	memcpy(header + 34, &imagesize, 4);
-
-	//prepare pixel data:
-	unsigned char* buf = malloc(imagesize);
-	for(int row = height - 1; row >= 0; row--) {
-		for(int col = 0; col < width; col++) {
-
-			uint_fast8_t blue  = (uint8_t)rngfunction();
-			uint_fast8_t green = (uint8_t)rngfunction();
-			uint_fast8_t red   = (uint8_t)rngfunction();
-
-#ifdef GRAYSCALE
-			uint_fast8_t gray = 0.3*red + 0.59*green + 0.11*blue;
-			blue = green = red = gray;
+// Bulk fill wrapper for each RNG, writing the low byte of each output
+#define RNG_FILL(name) \
+static void fill_##name(uint8_t *buf, size_t n) { \
+	for (size_t i = 0; i < n; ++i) { buf[i] = (uint8_t)name(); } \
+}
+RNG_FILL(pcg8)
+RNG_FILL(pcg8_fast)
+RNG_FILL(pcg16)
+RNG_FILL(pcg16_fast)
+RNG_FILL(pcg32)
+RNG_FILL(pcg32_fast)
+RNG_FILL(rnd_xorshift_16)
+RNG_FILL(xorshift32)
+RNG_FILL(xorshift64)
+RNG_FILL(xorshift128)
+RNG_FILL(xoshiro256ss)
+RNG_FILL(xoshiro256p)
+RNG_FILL(xoroshiro128p)
+RNG_FILL(xoroshiro128pp)
+RNG_FILL(xoroshiro128ss)
+RNG_FILL(tzarc_prng)
+RNG_FILL(xshift8)
+RNG_FILL(jsf64)
+RNG_FILL(jsf32)
+RNG_FILL(jsf16)
+RNG_FILL(jsf8)
+RNG_FILL(crand)
+
+
+
+// Row function for image_write(): each row is filled with blue, green,
+// red samples in one call, then reduced to gray for GRAYSCALE or PGM
+static void generate_row(void *arg, uint8_t *pixel, uint32_t width, int channels) {
+	void (*fillfunction)(uint8_t *buf, size_t n) = *(void (**)(uint8_t *, size_t))arg;
+	fillfunction(pixel, (size_t)width * 3);
+
+#ifndef GRAYSCALE
+	if (channels == 3) { return; }
 #endif
-			buf[row * width_in_bytes + col * 3 + 0] = blue;
-			buf[row * width_in_bytes + col * 3 + 1] = green;
-			buf[row * width_in_bytes + col * 3 + 2] = red;
-		}
+	uint8_t *out = pixel;
+	for(uint32_t col = 0; col < width; col++, pixel += 3) {
+		uint_fast8_t blue  = pixel[0];
+		uint_fast8_t green = pixel[1];
+		uint_fast8_t red   = pixel[2];
+
+		uint_fast8_t gray = 0.3*red + 0.59*green + 0.11*blue;
+		if (channels == 1) { out[col] = gray; }
+		else { pixel[0] = pixel[1] = pixel[2] = gray; }
 	}
+}
+
+// Streams a randomized pixel image into filename, a few rows at a time,
+// or draws it into the mapped file with MMAP
+void generate_image(void (*fillfunction)(uint8_t *buf, size_t n), char filename[]) {
+#ifdef MMAP
+	int const failed = image_write_mapped_rows(filename, WIDTH, HEIGHT, &generate_row, &fillfunction) != 0;
+#else
+	int const failed = image_write(filename, WIDTH, HEIGHT, &generate_row, &fillfunction) != 0;
+#endif
+	if (failed) { perror(filename); }
+}
 
-	FILE *fout = fopen(filename, "wb");
-	fwrite(header, 1, 54, fout);
-	fwrite((char*)buf, 1, imagesize, fout);
-	fclose(fout);
-	free(buf);
 
-	return;
+// Images rendered by main(), one per generator
+#define RNG_IMAGE(name) { &fill_##name, #name EXTENSION }
+static struct {
+	void (*fill)(uint8_t *buf, size_t n);
+	char *filename;
+} const images[] = {
+	RNG_IMAGE(pcg8),
+	RNG_IMAGE(pcg8_fast),
+	RNG_IMAGE(pcg16),
+	RNG_IMAGE(pcg16_fast),
+	RNG_IMAGE(pcg32),
+	RNG_IMAGE(pcg32_fast),
+	RNG_IMAGE(rnd_xorshift_16),
+	RNG_IMAGE(xorshift32),
+	RNG_IMAGE(xorshift64),
+	RNG_IMAGE(xorshift128),
+	RNG_IMAGE(xoshiro256ss),
+	RNG_IMAGE(xoshiro256p),
+	RNG_IMAGE(xoroshiro128p),
+	RNG_IMAGE(xoroshiro128pp),
+	RNG_IMAGE(xoroshiro128ss),
+	RNG_IMAGE(tzarc_prng),
+	RNG_IMAGE(xshift8),
+	RNG_IMAGE(jsf64),
+	RNG_IMAGE(jsf32),
+	RNG_IMAGE(jsf16),
+	RNG_IMAGE(jsf8),
+	RNG_IMAGE(crand),
+};
+#define IMAGES (sizeof(images) / sizeof(images[0]))
+
+// Pool worker: take the next image nobody has started until none are left
+static size_t next_image = 0;
+static void *render_images(void *arg) {
+	(void)arg;
+	size_t i;
+	while ((i = __atomic_fetch_add(&next_image, 1, __ATOMIC_RELAXED)) < IMAGES) {
+		generate_image(images[i].fill, images[i].filename);
+	}
+	return NULL;
 }
 
 
 int main(void) {
-
-	generate_image(&pcg8, "pcg8.bmp");
-	generate_image(&pcg8_fast, "pcg8_fast.bmp");
-	generate_image(&pcg16, "pcg16.bmp");
-	generate_image(&pcg16_fast, "pcg16_fast.bmp");
-	generate_image(&pcg32, "pcg32.bmp");
-	generate_image(&pcg32_fast, "pcg32_fast.bmp");
-	generate_image(&rnd_xorshift_16, "rnd_xorshift_16.bmp");
-	generate_image(&xorshift32, "xorshift32.bmp");
-	generate_image(&xorshift32, "xorshift64.bmp");
-	generate_image(&xorshift128, "xorshift128.bmp");
-	generate_image(&xoshiro256ss, "xoshiro256ss.bmp");
-	generate_image(&xoshiro256p, "xoshiro256p.bmp");
-	generate_image(&xoroshiro128p, "xoroshiro128p.bmp");
-	generate_image(&xoroshiro128pp, "xoroshiro128pp.bmp");
-	generate_image(&xoroshiro128ss, "xoroshiro128ss.bmp");
-	generate_image(&tzarc_prng, "tzarc_prng.bmp");
-	generate_image(&xshift8, "xshift8.bmp");
-	generate_image(&jsf64, "jsf64.bmp");
-	generate_image(&jsf32, "jsf32.bmp");
-	generate_image(&jsf16, "jsf16.bmp");
-	generate_image(&jsf8, "jsf8.bmp");
-	generate_image(&crand, "crand.bmp");
+#ifdef THREADS
+	long threads = THREADS;
+#else
+	long threads = sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+	if (threads < 1) { threads = 1; }
+	if (threads > (long)IMAGES) { threads = IMAGES; }
+
+	// main() is a worker too; if a thread can't be started the
+	// others simply take on its images
+	pthread_t pool[IMAGES];
+	long started = 0;
+	while (started < threads - 1 && pthread_create(&pool[started], NULL, render_images, NULL) == 0) { ++started; }
+	render_images(NULL);
+	for (long t = 0; t < started; ++t) { pthread_join(pool[t], NULL); }
 
 	// RNG number sampling
 //	for (int i = 100; i > 0; --i) { printf("rnd: 0x%16llx\n", xorshift128()); }
@@ -18,12 +18,40 @@
    image pixels. Good pseudo random generator will produce an image
    like white noise, and bad output will contain discernible patterns.
 
-   Bitmap file output settings can be configured with preprocessor
-   macros the follows. Pick one pseudo random generator function with
-   the RNG macro.
-
-   To test any pseudo random number generator function, add them above
-   main() function, and link it to the macro RND.
+   Everything is picked on the command line: the generator by name from
+   PRNG_LIST() in prng.h, the image size, which 8 bits of each output
+   make a pixel, and how outputs map to colors:
+   - gray:  one output per pixel, the same in all three colors
+   - mixed: one output per color, blended to gray (the default)
+   - rgb:   one output per color
+   For example:
+
+     cc -O2 -pthread rng_image_tester.c -o rng_image_tester -lm
+     ./rng_image_tester -w 4000 -h 4000 -s 8 -c gray pcg16
+
+   Every generator gets its own row function, instantiated from the
+   list with the sample loop specialized to its output type, so the
+   name is only looked up once and there is one indirect call per row
+   rather than per pixel. Images are streamed to file by image_write()
+   from image_stream.h, or drawn into a mapping of the file with -m.
+   Files named .pgm are written as 8-bit grayscale.
+
+   Three more views show what the low byte of single outputs can't:
+   - -p bit: one bit plane, white where that bit of the output is set,
+     or with -c mixed or rgb that bit of the output for each color
+   - -l lag: a lag plot, each pair of outputs (x_n, x_n+lag) marking
+     the point at their scaled values, x_n across and x_n+lag up
+   - -H: a 2D histogram of the low half of each output across against
+     the high half up
+   The last two count the points of -n samples, 16 per pixel by
+   default, and draw the counts as a log-scaled density so that lattice
+   structure, such as in the LCG state behind pcg8_fast, shows clearly.
+   Cell indices of a block of samples are computed in their own loop,
+   which compilers vectorize, before the counts are incremented.
+
+   To test any other pseudo random number generator, give it a context
+   struct, a PRNG_INIT_ seed, a *_next() and a *_fill() as for random8
+   below, and add it to TESTER_LIST.
  */
 
 
@@ -31,440 +59,290 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
+#include <unistd.h>
+#include <math.h>
+
+#include "../prng.h"
+#include "image_stream.h"
 
-// Image output settings
-#define BIGSAMPLE // RNG on each color
+// Default image settings
 #define WIDTH  1500
 #define HEIGHT 1500
-#define FILENAME "24bit.bmp"
-
-
-// RNG function selection, pick one
-//#define RND pcg8()
-//#define RND pcg8_fast()
-//#define RND pcg16()
-//#define RND pcg16_fast()
-//#define RND pcg32()
-//#define RND pcg32_fast()
-//#define RND xorshift32()
-//#define RND xorshift64()
-//#define RND xorshift128()
-//#define RND xoshiro256ss()
-//#define RND xoshiro256p()
-//#define RND xoroshiro128p()
-//#define RND xoroshiro128pp()
-//#define RND xoroshiro128ss()
-//#define RND brad16()
-#define RND tzarc_prng()
-//#define RND xshift8()
-//#define RND jsf64()
-//#define RND jsf32()
-//#define RND jsf16()
-//#define RND jsf8()
-//#define RND jsfsmall()
-//#define RND jsftiny()
-
-
-// pcg_mcg_16_xsh_rr_8_random_r
-uint8_t pcg8(void) {
-	static uint16_t state = 0x2af3;
-	static uint16_t const inc = 0x3c97;
-
-	uint16_t oldstate = state;
-	state = state * 12829U + (inc|1);
-
-	#define pcg_rot8(x,k) (((x) >> (k))|((x) << ((- k) & 7)))
-	return pcg_rot8((uint8_t)(((oldstate >> 5U) ^ oldstate) >> 5U), (oldstate >> 13U));
-}
-
-// pcg_mcg_16_xsh_rs_8_random_r
-uint8_t pcg8_fast(void) {
-	static uint16_t state = 0xc207;
-
-	uint16_t oldstate = state;
-	state = state * 12829U + 1U;
-
-	return ((oldstate >> 7U) ^ oldstate) >> ((oldstate >> 14U) + 3U);
-}
-
-
-// pcg_mcg_32_xsh_rr_16_random_r
-static uint16_t pcg16(void) {
-	static uint32_t state = 0x406832dd;
-
-	uint32_t oldstate = state;
-	state = state * 747796405U + 1U;
-
-/*	uint16_t value = ((oldstate >> 10U) ^ oldstate) >> 12U;
-	uint32_t rot = oldstate >> 28U;
-	return (value >> rot) | (value << ((- rot) & 15));*/
-	#define pcg_rot16(x,k) (((x) >> (k))|((x) << ((- k) & 15)))
-	return pcg_rot16((uint16_t)(((oldstate >> 10U) ^ oldstate) >> 12U), (oldstate >> 28U));
-}
-
-// pcg_mcg_32_xsh_rs_16_random_r
-static uint16_t pcg16_fast(void) {
-	static uint32_t state = 0x406832dd;
-
-	uint32_t oldstate = state;
-	state = state * 747796405U + 1U;
-
-	return ((oldstate >> 11U) ^ oldstate) >> ((oldstate >> 30U) + 11U);
-}
-
-
-// pcg_mcg_64_xsh_rr_32_random_r
-static uint32_t pcg32(void) {
-	static uint64_t state = 0x406832dd910219e5;
-
-	uint64_t oldstate = state;
-	state = state * 6364136223846793005ULL;
-
-	uint32_t value = ((oldstate >> 18U) ^ oldstate) >> 27U;
-	uint32_t rot = oldstate >> 59U;
-	return (value >> rot) | (value << ((- rot) & 31));
-}
-
-// pcg_mcg_64_xsh_rs_32_random_r
-static uint32_t pcg32_fast(void) {
-	static uint64_t state = 0x406832dd910219e5;
-
-	uint64_t oldstate = state;
-	state = state * 6364136223846793005ULL;
-
-	return ((oldstate >> 22U) ^ oldstate) >> ((oldstate >> 61U) + 22U);
-}
-
-
-
-
-// George Marsaglia's xorshift32
-// https://en.wikipedia.org/wiki/Xorshift
-static uint_fast32_t xorshift32(void) {
-	// Seed this 32 bit manually
-	static uint_fast32_t a = 0x2b2b0c5a;
-
-	uint_fast32_t x = a;
-	x ^= x << 13;
-	x ^= x >> 17;
-	x ^= x << 5;
-	return a = x;
-}
-
-// George Marsaglia's xorshift64
-// https://en.wikipedia.org/wiki/Xorshift
-static uint_fast64_t xorshift64(void) {
-	// Seed this 64 bit manually
-	static uint_fast64_t a = 0x0b7195eb5263650b;
-
-	uint_fast64_t x = a;
-	x ^= x << 13;
-	x ^= x >> 7;
-	x ^= x << 17;
-	return a = x;
-}
-
-// George Marsaglia's xorshift128
-// https://en.wikipedia.org/wiki/Xorshift
-static uint_fast32_t xorshift128(void) {
-	// Seed these 32 bit manually
-	static uint_fast32_t a = 0x16e12e4b;
-	static uint_fast32_t b = 0xe4d4a624;
-	static uint_fast32_t c = 0x80ccff3c;
-	static uint_fast32_t d = 0x3b9b979f;
-
-	uint_fast32_t t = d;
-	uint_fast32_t const s = a;
-	d = c; c = b; b = s;
-
-	t ^= t << 11;
-	t ^= t >> 8;
-	return a = t ^ s ^ (s >> 19);
-}
-
-
-
-// General-purpose xoshiro 64-bit PRNG variants
-// https://en.wikipedia.org/wiki/Xorshift
-static uint_fast64_t rol64(uint_fast64_t const x, int const k) {
-	return (x << k) | (x >> (64 - k));
-}
-
-// xoshiro256**
-static uint_fast64_t xoshiro256ss(void) {
-	// Seed these 64 bit manually
-	static uint_fast64_t s0 = 0x1e872bf277bbd5e4;
-	static uint_fast64_t s1 = 0xba317487d87c4159;
-	static uint_fast64_t s2 = 0x362fa9620e9a1c8a;
-	static uint_fast64_t s3 = 0xc918db525116e49c;
-
-	uint_fast64_t const result = rol64(s1 * 5, 7) * 9;
-	uint_fast64_t const t = s1 << 17;
+#define SIZE_MAX_PIXELS (1 << 20) // per side
 
-	s2 ^= s0;
-	s3 ^= s1;
-	s1 ^= s2;
-	s0 ^= s3;
 
-	s2 ^= t;
-	s3 = rol64(s3, 45);
-
-	return result;
+// FastLED's random8(), a 16-bit LCG folded down to 8 bits
+typedef struct { uint16_t seed; } random8_t;
+#define PRNG_INIT_random8 { 0x5eed }
+static inline uint8_t random8_next(random8_t *x) {
+	x->seed = (x->seed * (uint16_t)2053) + (uint16_t)13849;
+	return (uint8_t)((uint8_t)(x->seed & 0xFF) + (uint8_t)(x->seed >> 8));
 }
+PRNG_DEFINE_FILL(random8, uint8_t, random8_t)
+
+// Generators that can be tested, from prng.h and above
+#define TESTER_LIST(X) \
+	PRNG_LIST(X) \
+	X(random8, uint8_t, random8_t)
+
+
+typedef enum { COLOR_GRAY, COLOR_MIXED, COLOR_RGB } color_t;
+static char const *const color_names[] = { "gray", "mixed", "rgb" };
+
+// Settings passed to the row functions
+typedef struct {
+	int shift;
+	int plane; // only bit 0 of each sample, at shift
+	color_t color;
+} tester_t;
+
+// Turns one row of samples, a byte each at the start of pixels, into
+// width pixels of channels bytes. Blending uses the same weights as
+// multi_rng_image.c, and rgb rows are blended too for gray files.
+static void shade_row(uint8_t *pixels, uint32_t width, int channels, tester_t const *t) {
+	color_t const color = t->color;
+	size_t const n = (size_t)width * (color == COLOR_GRAY ? 1 : 3);
+	for (size_t i = 0; t->plane && i < n; ++i) { pixels[i] = (uint8_t)-(pixels[i] & 1); }
+	if (color == COLOR_GRAY) {
+		// spread backwards so no sample is overwritten before it is read
+		for (uint32_t col = width; channels == 3 && col-- > 0;) {
+			pixels[3 * col] = pixels[3 * col + 1] = pixels[3 * col + 2] = pixels[col];
+		}
+		return;
+	}
+	if (color == COLOR_RGB && channels == 3) { return; }
 
-// xoshiro256+ faster variant
-static uint_fast64_t xoshiro256p(void) {
-	// Seed these 64 bit manually
-	static uint_fast64_t s0 = 0x300eb059795dc07c;
-	static uint_fast64_t s1 = 0x5b80e5ea8841a0cf;
-	static uint_fast64_t s2 = 0x919572a617c344d3;
-	static uint_fast64_t s3 = 0xa92e3913be8d584d;
-
-	uint_fast64_t const result = s0 + s3;
-	uint_fast64_t const t = s1 << 17;
-
-	s2 ^= s0;
-	s3 ^= s1;
-	s1 ^= s2;
-	s0 ^= s3;
-
-	s2 ^= t;
-	s3 = rol64(s3, 45);
+	uint8_t *out = pixels;
+	for (uint32_t col = 0; col < width; col++, pixels += 3) {
+		uint_fast8_t blue  = pixels[0];
+		uint_fast8_t green = pixels[1];
+		uint_fast8_t red   = pixels[2];
 
-	return result;
+		uint_fast8_t gray = 0.3*red + 0.59*green + 0.11*blue;
+		if (channels == 1) { out[col] = gray; }
+		else { pixels[0] = pixels[1] = pixels[2] = gray; }
+	}
 }
 
-
-
-// xoroshiro 64-bit PRNG variants
-// Utilizes the same xoshiro rotate function
-// https://prng.di.unimi.it/
-// xoroshiro128+
-static uint_fast64_t xoroshiro128p(void) {
-	// Seed these 64 bit manually
-	static uint_fast64_t s0 = 0x305e0bc4831f6240;
-	static uint_fast64_t s1 = 0x7cff19974aef796d;
-
-	uint_fast64_t const t0 = s0;
-	uint_fast64_t t1 = s1;
-	uint_fast64_t const result = t0 + t1;
-
-	t1 ^= t0;
-	s0 = rol64(t0, 24) ^ t1 ^ (t1 << 16); // a, b
-	s1 = rol64(t1, 37); // c
-
-	return result;
+// Samples drawn per fill call
+#define BLOCK 256
+
+// Row function for each generator, with its context starting from the
+// default seed. Samples are drawn a block at a time with <name>_fill()
+// and the selected 8 bits of each kept as a byte.
+#define TESTER_ROW(name, type, ctx) \
+static ctx name##_state = PRNG_INIT_##name; \
+static void row_##name(void *arg, uint8_t *pixels, uint32_t width, int channels) { \
+	tester_t const *t = arg; \
+	int const shift = t->shift; \
+	size_t const n = (size_t)width * (t->color == COLOR_GRAY ? 1 : 3); \
+	type v[BLOCK]; \
+	for (size_t i = 0; i < n; i += BLOCK) { \
+		size_t const m = n - i < BLOCK ? n - i : BLOCK; \
+		name##_fill(&name##_state, v, m); \
+		for (size_t j = 0; j < m; ++j) { pixels[i + j] = (uint8_t)(v[j] >> shift); } \
+	} \
+	shade_row(pixels, width, channels, t); \
 }
-
-// xoroshiro128++
-static uint_fast64_t xoroshiro128pp(void) {
-	// Seed these 64 bit manually
-	static uint_fast64_t s0 = 0xaafdbd4fce743b4d;
-	static uint_fast64_t s1 = 0xcaee5c952c4ae6a8;
-
-	uint_fast64_t const t0 = s0;
-	uint_fast64_t t1 = s1;
-	uint_fast64_t const result = rol64(t0 + t1, 17) + t0;
-
-	t1 ^= t0;
-	s0 = rol64(t0, 49) ^ t1 ^ (t1 << 21); // a, b
-	s1 = rol64(t1, 28); // c
-
-	return result;
+TESTER_LIST(TESTER_ROW)
+
+
+// Point counts for the lag plot and the 2D histogram, row 0 at the
+// bottom, and the row density_row() draws next from the top
+typedef struct {
+	uint32_t *counts;
+	uint32_t width, height;
+	int lag; // 0 for the histogram of halves
+	uint32_t row;
+	double scale;
+} density_t;
+
+#define MAX_LAG 64
+
+// Cell of the point at a across and b up, both scaled to 64 bits
+static inline uint32_t density_cell(density_t const *d, uint64_t a, uint64_t b) {
+	uint32_t const col = (uint32_t)((a >> 32) * d->width >> 32);
+	uint32_t const row = (uint32_t)((b >> 32) * d->height >> 32);
+	return row * d->width + col;
 }
 
-// xoroshiro128**
-static uint_fast64_t xoroshiro128ss(void) {
-	// Seed these 64 bit manually
-	static uint_fast64_t s0 = 0xa838cd0e0aeb110b;
-	static uint_fast64_t s1 = 0x99fe19b209da8e32;
-
-	uint_fast64_t const t0 = s0;
-	uint_fast64_t t1 = s1;
-	uint_fast64_t const result = rol64(t0 * 5, 7) * 9;
-
-	t1 ^= t0;
-	s0 = rol64(t0, 24) ^ t1 ^ (t1 << 16); // a, b
-	s1 = rol64(t1, 37); // c
-
-	return result;
+// Counting loop for each generator. The last lag outputs of a block
+// are carried to the front of the next one, so every pair is counted
+// once without drawing any output twice.
+#define TESTER_DENSITY(name, type, ctx) \
+static void density_##name(density_t *d, uint64_t samples) { \
+	int const bits = 8 * sizeof(type); \
+	int const lag = d->lag; \
+	uint32_t *counts = d->counts; \
+	type v[MAX_LAG + BLOCK]; \
+	uint32_t cell[BLOCK]; \
+	name##_fill(&name##_state, v, lag); \
+	for (uint64_t i = 0; i < samples; i += BLOCK) { \
+		size_t const m = samples - i < BLOCK ? samples - i : BLOCK; \
+		name##_fill(&name##_state, v + lag, m); \
+		if (lag) { \
+			for (size_t j = 0; j < m; ++j) { \
+				cell[j] = density_cell(d, (uint64_t)v[j] << (64 - bits), (uint64_t)v[j + lag] << (64 - bits)); \
+			} \
+		} else { \
+			for (size_t j = 0; j < m; ++j) { \
+				cell[j] = density_cell(d, (uint64_t)v[j] << (64 - bits / 2), (uint64_t)(v[j] >> bits / 2) << (64 - bits / 2)); \
+			} \
+		} \
+		for (size_t j = 0; j < m; ++j) { ++counts[cell[j]]; } \
+		memmove(v, v + m, lag * sizeof(type)); \
+	} \
 }
-
-
-// Brad Forschinger's 16 bit xorshift rng
-// http://b2d-f9r.blogspot.com/2010/08/16-bit-xorshift-rng-now-with-more.html
-uint16_t brad16(void) {
-	static uint8_t const a = 5, b = 3, c = 13;
-	static uint16_t x = 1, y = 1;
-	uint16_t t = (x ^ (x << a));
-	x = y * 3;
-	return y = (y ^ (y >> c)) ^ (t ^ (t >> b));
-}
-
-
-// @tzarc's 8 bit XORshift, produces minor repeated pattern
-// https://github.com/tzarc/qmk_build/blob/bebe5e5b21e99bdb8ff41500ade1eac2d8417d8c/users-tzarc/tzarc_common.c#L57-L63
-static uint8_t tzarc_prng(void) {
-	static uint8_t s = 15, a = 97;
-	s ^= s << 3;
-	s ^= s >> 5;
-	s ^= a++ >> 2;
-	return s;
-}
-
-j
-
-// Simple 4-register 8 bit XORshift
-// https://github.com/edrosten/8bit_rng
-static uint_fast8_t xshift8(void) {
-	static uint_fast8_t x = 0, y = 0, z = 0, a = 1;
-	uint_fast8_t t = x ^ (x << 5);
-	x = y; y = z; z = a;
-	return a = z ^ ( z >> 1) ^ t ^ (t << 3);
+TESTER_LIST(TESTER_DENSITY)
+
+// Row function drawing the counts, log-scaled from black for none to
+// white for the densest cell
+static void density_row(void *arg, uint8_t *pixels, uint32_t width, int channels) {
+	density_t *d = arg;
+	uint32_t const *counts = d->counts + (size_t)(d->height - 1 - d->row++) * width;
+	for (uint32_t col = 0; col < width; ++col) {
+		pixels[col] = (uint8_t)(log1p(counts[col]) * d->scale);
+	}
+	tester_t const gray = { 0, 0, COLOR_GRAY };
+	shade_row(pixels, width, channels, &gray);
 }
 
-
-
-// http://burtleburtle.net/bob/rand/smallprng.html
-// jsf = Jenkins Small Fast
-// Bob Jenkins PRNG in 64-bit
-#define rot64(x,k) ((x << k)|(x >> (64 - k)))
-uint64_t jsf64(void) {
-	static uint64_t a = 0xf1eaeb0597955eed;
-	static uint64_t b = 0x80ccff3cee5c952c, c = 0x80ccff3cee5c952c, d = 0x80ccff3cee5c952c;
-
-	uint64_t e = a - rot64(b, 7);
-	a = b ^ rot64(c, 13);
-	b = c + rot64(d, 37);
-	c = d + e;
-	return d = e + a;
-}
-// Bob Jenkins PRNG in 32-bit
-#define rot32(x,k) ((x << k)|(x >> (32 - k)))
-uint32_t jsf32(void) {
-	static uint32_t a = 0xf1ea5eed;
-	static uint32_t b = 0x80ccff3c, c = 0x80ccff3c, d = 0x80ccff3c;
-
-	uint32_t e = a - rot32(b, 27);
-	a = b ^ rot32(c, 17);
-	b = c + d;
-	c = d + e;
-	return d = e + a;
-}
-// Bob Jenkins PRNG in 16-bit
-#define rot16(x,k) ((x << k)|(x >> (16 - k)))
-uint16_t jsf16(void) {
-	static uint16_t a = 0xf1ea;
-	static uint16_t b = 0x80cc, c = 0x80cc, d = 0x80cc;
-
-	uint16_t e = a - rot16(b, 13);
-	a = b ^ rot16(c, 8);
-	b = c + d;
-	c = d + e;
-	return d = e + a;
-}
-// Bob Jenkins PRNG in 8-bit
-#define rot8(x,k) ((x << k)|(x >> (8 - k)))
-uint8_t jsf8(void) {
-	static uint8_t a = 0xf1;
-	static uint8_t b = 0xee, c = 0xee, d = 0xee;
-
-	uint8_t e = a - rot8(b, 1);
-	a = b ^ rot8(c, 4);
-	b = c + d;
-	c = d + e;
-	return d = e + a;
+typedef struct {
+	char const *name;
+	int bits;
+	image_row_fn row;
+	void (*density)(density_t *d, uint64_t samples);
+} tester_entry_t;
+
+#define TESTER_ENTRY(name, type, ctx) { #name, 8 * sizeof(type), row_##name, density_##name },
+static tester_entry_t const tester_table[] = {
+	TESTER_LIST(TESTER_ENTRY)
+};
+#define TESTER_COUNT (sizeof(tester_table) / sizeof(tester_table[0]))
+
+
+// Parse an image side, 1 to SIZE_MAX_PIXELS
+static uint32_t parse_side(char const *arg) {
+	char *end;
+	unsigned long n = strtoul(arg, &end, 0);
+	return *end == '\0' && n >= 1 && n <= SIZE_MAX_PIXELS ? (uint32_t)n : 0;
 }
 
-uint8_t jsfsmall(void) {
-	static uint8_t a = 0x9d, b = 0x78, c = 0x78;
-	uint8_t t = a - ((b << 1)|(b >> 7));
-	a = b ^ ((c << 4)|(c >> 4));
-	b = c + t;
-	return c = t + a;
+// Parse a sample count with optional K, M or G suffix
+static uint64_t parse_count(char const *arg) {
+	char *end;
+	unsigned long long n = strtoull(arg, &end, 0);
+	if (*end == 'k' || *end == 'K') { n <<= 10; ++end; }
+	else if (*end == 'm' || *end == 'M') { n <<= 20; ++end; }
+	else if (*end == 'g' || *end == 'G') { n <<= 30; ++end; }
+	return *end == '\0' ? n : 0;
 }
 
-
-uint8_t random8(void) {
-	static uint16_t rand16seed = 0x5eed;
-	rand16seed = (rand16seed * (uint16_t)2053) + (uint16_t)13849;
-	return (uint8_t)(((uint8_t)(rand16seed & 0xFF)) + ((uint8_t)(rand16seed >> 8)));
+static void usage(char const *prog) {
+	fprintf(stderr, "usage: %s [-w width] [-h height] [-s shift | -p bit] [-c color] [-l lag | -H] [-n samples] [-m] [-o file] <generator>\n", prog);
+	fprintf(stderr, "  -w, -h    image size in pixels (default %dx%d)\n", WIDTH, HEIGHT);
+	fprintf(stderr, "  -s shift  lowest of the 8 output bits used per sample (default 0)\n");
+	fprintf(stderr, "  -p bit    draw one bit plane of the outputs\n");
+	fprintf(stderr, "  -c color  gray, mixed or rgb (default mixed)\n");
+	fprintf(stderr, "  -l lag    lag plot of output pairs (x_n, x_n+lag), lag 1 to %d\n", MAX_LAG);
+	fprintf(stderr, "  -H        2D histogram of low against high half of outputs\n");
+	fprintf(stderr, "  -n count  points counted for -l and -H, K, M or G suffix (default 16 per pixel)\n");
+	fprintf(stderr, "  -m        draw into a memory mapping of the file\n");
+	fprintf(stderr, "  -o file   output .bmp or .pgm (default <generator>.bmp)\n");
+	for (size_t i = 0; i < TESTER_COUNT; ++i) { fprintf(stderr, "  %-16s %d-bit\n", tester_table[i].name, tester_table[i].bits); }
 }
 
 
-
-
-// Main loop that generates randomized pixel image into 32bit.bmp
-// https://stackoverflow.com/questions/50090500/create-simple-bitmap-in-c-without-external-libraries
-int main(void) {
-	//width, height, and bitcount are the key factors:
-	static uint_fast32_t const width  = WIDTH;
-	static uint_fast32_t const height = HEIGHT;
-	static uint_fast16_t const bitcount = 24;//<- 24-bit bitmap
-
-	//take padding in to account
-	int width_in_bytes = ((width * bitcount + 31) / 32) * 4;
-
-	//total image size in bytes, not including header
-	uint_fast32_t imagesize = width_in_bytes * height;
-
-	//this value is always 40, it's the sizeof(BITMAPINFOHEADER)
-	static uint_fast32_t const biSize = 40;
-
-	//bitmap bits start after headerfile,
-	//this is sizeof(BITMAPFILEHEADER) + sizeof(BITMAPINFOHEADER)
-	static uint_fast32_t const bfOffBits = 54;
-
-	//total file size:
-	uint_fast32_t filesize = 54 + imagesize;
-
-	//number of planes is usually 1
-	static uint_fast16_t const biPlanes = 1;
-
-	//create header:
-	//copy to buffer instead of BITMAPFILEHEADER and BITMAPINFOHEADER
-	//to avoid problems with structure packing
-	unsigned char header[54] = { 0 };
-	memcpy(header, "BM", 2);
-	memcpy(header + 2 , &filesize, 4);
-	memcpy(header + 10, &bfOffBits, 4);
-	memcpy(header + 14, &biSize, 4);
-	memcpy(header + 18, &width, 4);
-	memcpy(header + 22, &height, 4);
-	memcpy(header + 26, &biPlanes, 2);
-	memcpy(header + 28, &bitcount, 2);
-	memcpy(header + 34, &imagesize, 4);
-
-	//prepare pixel data:
-	unsigned char* buf = malloc(imagesize);
-	for(int row = height - 1; row >= 0; row--) {
-		for(int col = 0; col < width; col++) {
-#ifndef BIGSAMPLE
-			uint_fast8_t blue, green, red;
-			blue = green = red = (uint8_t)RND;
-#else
-			uint_fast8_t blue  = (uint8_t)RND;
-			uint_fast8_t green = (uint8_t)RND;
-			uint_fast8_t red   = (uint8_t)RND;
-
-			uint_fast8_t gray = 0.3*red + 0.59*green + 0.11*blue;
-			//uint_fast8_t gray = (red + green + blue)/3;
-			blue = green = red = gray;
-#endif
-			buf[row * width_in_bytes + col * 3 + 0] = blue;
-			buf[row * width_in_bytes + col * 3 + 1] = green;
-			buf[row * width_in_bytes + col * 3 + 2] = red;
+int main(int argc, char** argv) {
+	tester_entry_t const *rng = NULL;
+	tester_t settings = { 0, 0, COLOR_MIXED };
+	uint32_t width = WIDTH, height = HEIGHT;
+	int lag = -1; // no density plot
+	uint64_t samples = 0;
+	char const *filename = NULL;
+	int mapped = 0;
+	int colored = 0;
+	int opt;
+
+	while ((opt = getopt(argc, argv, "w:h:s:p:c:l:Hn:mo:")) != -1) {
+		switch (opt) {
+		case 'w':
+			if ((width = parse_side(optarg)) == 0) { usage(argv[0]); return 1; }
+			break;
+		case 'h':
+			if ((height = parse_side(optarg)) == 0) { usage(argv[0]); return 1; }
+			break;
+		case 's':
+			settings.shift = atoi(optarg);
+			break;
+		case 'p':
+			settings.shift = atoi(optarg);
+			settings.plane = 1;
+			break;
+		case 'c':
+			colored = 1;
+			for (settings.color = COLOR_GRAY; settings.color <= COLOR_RGB; ++settings.color) {
+				if (strcmp(optarg, color_names[settings.color]) == 0) { break; }
+			}
+			if (settings.color > COLOR_RGB) { usage(argv[0]); return 1; }
+			break;
+		case 'l':
+			lag = atoi(optarg);
+			if (lag < 1 || lag > MAX_LAG) { usage(argv[0]); return 1; }
+			break;
+		case 'H':
+			lag = 0;
+			break;
+		case 'n':
+			if ((samples = parse_count(optarg)) == 0) { usage(argv[0]); return 1; }
+			break;
+		case 'm':
+			mapped = 1;
+			break;
+		case 'o':
+			filename = optarg;
+			break;
+		default:
+			usage(argv[0]);
+			return 1;
 		}
 	}
 
-	FILE *fout = fopen(FILENAME, "wb");
-	fwrite(header, 1, 54, fout);
-	fwrite((char*)buf, 1, imagesize, fout);
-	fclose(fout);
-	free(buf);
+	// Resolve generator name once before drawing
+	for (size_t i = 0; optind < argc && i < TESTER_COUNT; ++i) {
+		if (strcmp(argv[optind], tester_table[i].name) == 0) { rng = &tester_table[i]; break; }
+	}
+	// A bit plane is one output per pixel unless -c says otherwise
+	if (settings.plane && !colored) { settings.color = COLOR_GRAY; }
+	if (!rng || settings.shift < 0 || settings.shift > rng->bits - (settings.plane ? 1 : 8)) { usage(argv[0]); return 1; }
+
+	char defaultname[64];
+	if (!filename) {
+		snprintf(defaultname, sizeof(defaultname), "%s.bmp", rng->name);
+		filename = defaultname;
+	}
+
+	image_row_fn row = rng->row;
+	void *arg = &settings;
+	density_t density = { NULL, width, height, lag, 0, 0 };
+	if (lag >= 0) {
+		// Count every point first, then draw the counts
+		density.counts = calloc((size_t)width * height, sizeof(uint32_t));
+		if (!density.counts) { perror("calloc"); return 1; }
+		rng->density(&density, samples ? samples : (uint64_t)width * height * 16);
+
+		uint32_t max = 0;
+		for (size_t i = 0; i < (size_t)width * height; ++i) { max = density.counts[i] > max ? density.counts[i] : max; }
+		density.scale = max ? 255.0 / log1p(max) : 0;
+		row = density_row;
+		arg = &density;
+	}
 
-	// RNG number sampling
-//	for (int i = 100; i > 0; --i) { printf("rnd: 0x%16llx\n", RND); }
+	int const failed = mapped
+		? image_write_mapped_rows(filename, width, height, row, arg)
+		: image_write(filename, width, height, row, arg);
+	free(density.counts);
+	if (failed) { perror(filename); return 1; }
 
 	return 0;
 }